@@ -3,10 +3,78 @@
 //
 
 #include "utils/GameConsole.h"
+#include "utils/Benchmark.h"
 
-int main()
+int main(int argc, char* argv[])
 {
     try {
+        // Optional Prometheus textfile output for headless deployments:
+        //   --metrics-file <path> [--metrics-interval <seconds>]
+        // Benchmark modes run instead of the game:
+        //   --bench-memory [WxH ...]
+        //   --bench-simulate [games]
+        //   --bench-adjacency [WxH] [max threads]
+        //   --bench-layout [WxH]
+        //   --bench-nd [edge]
+        //   --bench-generate [WxH] [threads]
+        //   --bench-batch [games]
+        //   --bench-reveal-index [width]
+        std::string metricsPath;
+        long metricsInterval = 15;
+        for (int i = 1; i < argc; ++i) {
+            const std::string option = argv[i];
+            if (option == "--bench-memory") {
+                Benchmark::memory(std::vector<std::string>(argv + i + 1, argv + argc));
+                return 0;
+            }
+            if (option == "--bench-adjacency") {
+                const std::string size = i + 1 < argc ? argv[i + 1] : "4000x4000";
+                const int threads = i + 2 < argc ? std::max(1, std::atoi(argv[i + 2]))
+                                                 : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+                Benchmark::adjacency(size, threads);
+                return 0;
+            }
+            if (option == "--bench-layout") {
+                Benchmark::layout(i + 1 < argc ? argv[i + 1] : "4000x4000");
+                return 0;
+            }
+            if (option == "--bench-nd") {
+                Benchmark::ndBoard(i + 1 < argc ? std::max(1, std::atoi(argv[i + 1])) : 256);
+                return 0;
+            }
+            if (option == "--bench-generate") {
+                const std::string size = i + 1 < argc ? argv[i + 1] : "1024x1024";
+                const int threads = i + 2 < argc ? std::max(1, std::atoi(argv[i + 2]))
+                                                 : std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+                Benchmark::generator(size, threads);
+                return 0;
+            }
+            if (option == "--bench-reveal-index") {
+                Benchmark::revealIndex(i + 1 < argc ? std::max(1, std::atoi(argv[i + 1])) : 16000);
+                return 0;
+            }
+            if (option == "--bench-batch") {
+                Benchmark::batch(i + 1 < argc ? std::max(1, std::atoi(argv[i + 1])) : 1000);
+                return 0;
+            }
+            if (option == "--bench-simulate") {
+                Benchmark::simulate(i + 1 < argc ? std::max(1, std::atoi(argv[i + 1])) : 1000);
+                return 0;
+            }
+            if (i + 1 >= argc) {
+                break;
+            }
+            if (option == "--metrics-file") {
+                metricsPath = argv[++i];
+            } else if (option == "--metrics-interval") {
+                metricsInterval = std::max(1L, std::stol(argv[++i]));
+            }
+        }
+        std::unique_ptr<MetricsDumper> metricsDumper;
+        if (!metricsPath.empty()) {
+            metricsDumper = std::make_unique<MetricsDumper>(metricsPath, std::chrono::seconds(metricsInterval));
+        }
+
         auto *gameConsole = new GameConsole();
         gameConsole->displayWelcome();
         const Game::Difficulty difficulty = gameConsole->selectDifficulty();
@@ -15,16 +83,15 @@ int main()
         // Clear input buffer after difficulty selection
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-        const Game game(difficulty);
+        Game game(difficulty);
         std::string input;
 
         std::cout << "\nPress Enter to start playing..." << std::endl;
         std::getline(std::cin, input);
 
         while (true) {
-            std::cout << std::endl;
-            game.displayGameInfo();
-            game.displayBoard();
+            // Only the cells that changed are redrawn; status text goes below the board
+            gameConsole->renderFrame(game);
 
             if (game.isGameOver()) {
                 if (game.getState() == Game::GameState::WON) {
@@ -32,23 +99,23 @@ int main()
                     if (game.getLives() < game.getMaxLives()) {
                         std::cout << " (used " << (game.getMaxLives() - game.getLives()) << " lives)";
                     }
-                    std::cout << "! 🎉" << std::endl;
+                    std::cout << "! 🎉" << '\n';
                 } else {
-                    std::cout << "\n💀 GAME OVER - All lives lost! 💀" << std::endl;
+                    std::cout << "\n💀 GAME OVER - All lives lost! 💀" << '\n';
                 }
-                std::cout << "Type 'n' for new game or 'q' to quit." << std::endl;
+                std::cout << "Type 'n' for new game or 'q' to quit." << '\n';
             }
 
             std::cout << "\nEnter command: ";
-            std::getline(std::cin, input);
-
-            if (!gameConsole->processCommand(game, input)) {
-
+            if (!std::getline(std::cin, input)) {
+                break;
             }
 
-            // Clear screen for better visibility (optional)
-            gameConsole->clearScreen();
+            if (!gameConsole->runCommand(game, input)) {
+                break;
+            }
         }
+        return 0;
 
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
@@ -0,0 +1,552 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Game.h"
+#include "NdBoard.h"
+#include "BoardGenerator.h"
+#include "GameBatch.h"
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+// Non-interactive measurement modes selected from the command line
+class Benchmark {
+public:
+    // Print the per-session footprint of every preset and of custom "WxH" sizes,
+    // measured after the first reveal so the generation-time scratch is included
+    // Custom sizes use the EXPERT mine density
+    static void memory(const std::vector<std::string>& customSizes);
+
+    // Play games of every preset with a bot that knows the mines and report the
+    // layouts' 3BV, openings and isolated numbers, the bot's clicks and 3BV/s,
+    // and how many layouts per second can be generated and scored
+    static void simulate(int games);
+
+    // Time the adjacent count pass over one WxH layout with 1, 2, 4, ... up to
+    // maxThreads threads and report speed-up and efficiency against one thread,
+    // then the whole board generation with maxThreads threads, phase by phase
+    static void adjacency(const std::string& size, int maxThreads);
+
+    // Compare the cell layouts on one sparse WxH layout: time and hardware cache
+    // misses of the adjacent count pass and of a breadth-first fill over the
+    // board, both on one thread. Misses show "n/a" where perf events are not
+    // available to the process
+    static void layout(const std::string& size);
+
+    // Generate and open a size^3 board and a 4D board of about as many cells,
+    // with one mine per hundred cells: time of the mine placement with the
+    // adjacency pass, and of the flood fill from the first click at the center
+    static void ndBoard(int size);
+
+    // Worst case of RevealIndex::onReveal(): a checkerboard of one row's even
+    // columns added right to left, so every reveal starts a run in front of
+    // all others, then the odd columns left to right, so every reveal joins
+    // the two runs in front; both next to the same checkerboard added left to
+    // right, where runs are appended
+    static void revealIndex(int width);
+
+    // Run BoardGenerator for one WxH board on a pool of the given threads and
+    // time it; throws when no valid board comes back. From PARALLEL_MIN_CELLS on
+    // the candidates are large enough for Board's own parallel paths, which must
+    // not wait on the pool whose tasks build them
+    static void generator(const std::string& size, int threads);
+
+    // Step a GameBatch of BEGINNER games next to Games seeded with the same
+    // streams, on one random action sequence per game, and time both; throws
+    // when lives, the end of a game or any visible cell differ after a step
+    static void batch(int games);
+
+private:
+    template <int D>
+    static void ndRun(const typename NdBoard<D>::Point& extents);
+    template <class Layout>
+    static void layoutRun(const char* name, int width, int height, std::span<const std::pair<int, int>> mines);
+    static int startCacheMisses();
+    static long long stopCacheMisses(int counter);
+    static void printBoardUsage(const std::string& label, const Board::MemoryUsage& usage, size_t sessionTotal);
+    static bool parseSize(const std::string& text, int& width, int& height);
+};
+
+inline void Benchmark::printBoardUsage(const std::string& label, const Board::MemoryUsage& usage, size_t sessionTotal) {
+    std::cout << std::left << std::setw(16) << label << std::right
+              << std::setw(12) << usage.grid
+              << std::setw(10) << usage.rows
+              << std::setw(8) << usage.rng
+              << std::setw(10) << usage.scratch
+              << std::setw(12) << usage.total()
+              << std::setw(12) << sessionTotal
+              << std::setw(14) << std::fixed << std::setprecision(1)
+              << static_cast<double>(sessionTotal) * 1000.0 / (1024.0 * 1024.0) << '\n';
+}
+
+inline void Benchmark::generator(const std::string& size, int threads) {
+    int width, height;
+    if (!parseSize(size, width, height)) {
+        std::cout << "Invalid size '" << size << "' (expected WxH)" << '\n';
+        return;
+    }
+    ThreadPool pool(std::max(1, threads) - 1);
+    const int mines = static_cast<int>(static_cast<long long>(width) * height / 5);
+    const BoardGenerator::Target any{BoardGenerator::BBBV, 0, std::numeric_limits<int>::max()};
+    const auto begin = std::chrono::steady_clock::now();
+    const std::unique_ptr<Board> board =
+        BoardGenerator::generate(width, height, mines, height / 2, width / 2, any, 1, 1000, pool);
+    const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    if (!board || board->isMineAt(height / 2, width / 2)) {
+        throw std::runtime_error("BoardGenerator returned no valid " + size + " board");
+    }
+    std::cout << size << ", " << static_cast<long long>(width) * height << " cells, " << pool.size() << " threads: "
+              << std::fixed << std::setprecision(1) << elapsed << " ms, 3BV " << BoardStats::compute(*board).bbbv
+              << '\n';
+    std::cout.flush();
+}
+
+inline void Benchmark::batch(int games) {
+    int width, height, mines;
+    Game(Game::Difficulty::BEGINNER).getDifficultySettings(width, height, mines);
+    const int cells = width * height;
+    const uint64_t seed = 1;
+    GameBatch batch(games, width, height, mines, seed);
+    std::vector<std::unique_ptr<Game>> reference;
+    for (int game = 0; game < games; ++game) {
+        reference.push_back(std::make_unique<Game>(Game::Difficulty::BEGINNER, SplitMix64::stream(seed, game)));
+    }
+
+    // Each game is compared until its first game ends; the batch resets it then,
+    // so it gets no further actions. Reveals on flags and flags before the first
+    // reveal are part of the mix
+    std::vector<GameBatch::Action> actions(games);
+    std::vector<uint8_t> visible(static_cast<size_t>(games) * cells);
+    std::vector<uint8_t> active(games, 1);
+    uint64_t rng = seed;
+    long long moves = 0;
+    double gameSeconds = 0.0, batchSeconds = 0.0;
+    for (int live = games; live > 0;) {
+        for (int game = 0; game < games; ++game) {
+            const uint64_t draw = SplitMix64::next(rng);
+            const uint8_t type = draw % 10 < 5 ? GameBatch::REVEAL : draw % 10 < 8 ? GameBatch::FLAG : GameBatch::CHORD;
+            actions[game] = {active[game] ? static_cast<int32_t>((draw >> 8) % cells) : -1, type};
+        }
+        auto begin = std::chrono::steady_clock::now();
+        for (int game = 0; game < games; ++game) {
+            if (active[game]) {
+                const GameBatch::Action& action = actions[game];
+                reference[game]->makeMove(action.cell / width, action.cell % width, "rfc"[action.type]);
+            }
+        }
+        gameSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        begin = std::chrono::steady_clock::now();
+        batch.step(actions);
+        batchSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        batch.observe(visible);
+
+        for (int game = 0; game < games; ++game) {
+            if (!active[game]) {
+                continue;
+            }
+            moves += 1;
+            const Game& expected = *reference[game];
+            const std::string where = "game " + std::to_string(game) + " after move " + std::to_string(moves);
+            if (batch.done()[game]) {
+                if (!expected.isGameOver() || (expected.getState() == Game::GameState::WON) != (batch.won()[game] != 0)) {
+                    throw std::runtime_error("GameBatch ended a game Game did not, " + where);
+                }
+                active[game] = 0;
+                live -= 1;
+                continue;
+            }
+            if (expected.isGameOver() || expected.getLives() != batch.getLives(game)) {
+                throw std::runtime_error("GameBatch lives differ from Game, " + where);
+            }
+            const Board& board = *expected.getBoard();
+            for (int cell = 0; cell < cells; ++cell) {
+                const uint8_t code = Cell::visibleCode(board.getCell(cell / width, cell % width).getPacked());
+                if (visible[static_cast<size_t>(game) * cells + cell] != code) {
+                    throw std::runtime_error("GameBatch cell " + std::to_string(cell) + " differs from Game, " + where);
+                }
+            }
+        }
+    }
+    std::cout << games << " BEGINNER games, " << moves << " moves agree; Game "
+              << std::fixed << std::setprecision(1) << gameSeconds * 1e9 / static_cast<double>(moves)
+              << " ns/move, GameBatch " << batchSeconds * 1e9 / static_cast<double>(moves) << " ns/move" << '\n';
+    std::cout.flush();
+}
+
+inline bool Benchmark::parseSize(const std::string& text, int& width, int& height) {
+    const size_t split = text.find_first_of("xX");
+    if (split == std::string::npos)
+        return false;
+    try {
+        width = std::stoi(text.substr(0, split));
+        height = std::stoi(text.substr(split + 1));
+    } catch (const std::exception&) {
+        return false;
+    }
+    return width > 0 && height > 0;
+}
+
+inline void Benchmark::memory(const std::vector<std::string>& customSizes) {
+    std::ostringstream header;
+    header << std::left << std::setw(16) << "board" << std::right
+           << std::setw(12) << "grid" << std::setw(10) << "rows" << std::setw(8) << "rng"
+           << std::setw(10) << "scratch" << std::setw(12) << "board" << std::setw(12) << "session"
+           << std::setw(14) << "MiB/1000";
+    std::cout << header.str() << '\n';
+    std::cout << std::string(header.str().size(), '-') << '\n';
+
+    const std::pair<Game::Difficulty, const char*> presets[] = {
+        {Game::Difficulty::BEGINNER, "BEGINNER"},
+        {Game::Difficulty::INTERMEDIATE, "INTERMEDIATE"},
+        {Game::Difficulty::EXPERT, "EXPERT"},
+    };
+    for (const auto& [difficulty, name] : presets) {
+        Game game(difficulty);
+        int width, height, mines;
+        game.getDifficultySettings(width, height, mines);
+        game.makeMove(height / 2, width / 2, 'r');
+        // Taken before getBoard() below: a BEGINNER session holds no Board until one is asked for
+        const size_t session = game.memoryUsage();
+        printBoardUsage(name, game.getBoard()->memoryUsage(), session);
+    }
+
+    // Custom sizes have no preset, so the session total is the board plus an empty game
+    for (const std::string& size : customSizes) {
+        int width, height;
+        if (!parseSize(size, width, height)) {
+            std::cout << "Skipping invalid size '" << size << "' (expected WxH)" << '\n';
+            continue;
+        }
+        Board board(width, height, static_cast<int>(static_cast<long long>(width) * height / 5));
+        board.revealCell(height / 2, width / 2);
+        const Board::MemoryUsage usage = board.memoryUsage();
+        printBoardUsage(size, usage, sizeof(Game) + usage.total());
+    }
+    std::cout.flush();
+}
+
+inline void Benchmark::simulate(int games) {
+    std::ostringstream header;
+    header << std::left << std::setw(14) << "level" << std::right
+           << std::setw(8) << "games" << std::setw(9) << "3BV avg" << std::setw(8) << "min" << std::setw(8) << "max"
+           << std::setw(10) << "openings" << std::setw(10) << "isolated" << std::setw(9) << "clicks"
+           << std::setw(12) << "bot 3BV/s" << std::setw(14) << "layouts/s";
+    std::cout << header.str() << '\n';
+    std::cout << std::string(header.str().size(), '-') << '\n';
+
+    const std::pair<Game::Difficulty, const char*> presets[] = {
+        {Game::Difficulty::BEGINNER, "BEGINNER"},
+        {Game::Difficulty::INTERMEDIATE, "INTERMEDIATE"},
+        {Game::Difficulty::EXPERT, "EXPERT"},
+    };
+    for (const auto& [difficulty, name] : presets) {
+        long long totalBbbv = 0, totalOpenings = 0, totalIsolated = 0, totalClicks = 0;
+        int minBbbv = std::numeric_limits<int>::max(), maxBbbv = 0;
+        double seconds = 0.0;
+        for (int g = 0; g < games; ++g) {
+            Game game(difficulty);
+            int width, height, mines;
+            game.getDifficultySettings(width, height, mines);
+            game.makeMove(height / 2, width / 2, 'r');
+            int clicks = 1;
+            // Openings first, then whatever is left hidden; nextUnresolved() skips
+            // the rows and tiles that are already finished
+            // The board is fetched after every move, BEGINNER games update it on demand
+            for (int pass = 0; pass < 2 && !game.isGameOver(); ++pass) {
+                for (int i = 0, j = 0; game.getBoard()->nextUnresolved(i, j); ++j) {
+                    if (pass == 1 || game.getBoard()->getCell(i, j).getAdjacentMines() == 0) {
+                        game.makeMove(i, j, 'r');
+                        clicks += 1;
+                    }
+                }
+            }
+            seconds += game.getElapsedTime();
+            const BoardStats& stats = *game.getBoardStats();
+            totalBbbv += stats.bbbv;
+            totalOpenings += stats.openings;
+            totalIsolated += stats.isolatedNumbers;
+            totalClicks += clicks;
+            minBbbv = std::min(minBbbv, stats.bbbv);
+            maxBbbv = std::max(maxBbbv, stats.bbbv);
+        }
+
+        // Scoring throughput: layouts of the preset generated and scored, the
+        // opening labelling BoardStats reads from included
+        Game sample(difficulty);
+        Board& layout = *sample.getBoard();
+        const int rounds = std::max(1, games) * 10;
+        int sink = 0;
+        const auto begin = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            layout.reset();
+            layout.initializeMines(layout.getHeight() / 2, layout.getWidth() / 2);
+            sink += BoardStats::compute(layout).bbbv;
+        }
+        const double scoring = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        const double count = std::max(1, games);
+        std::cout << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << games
+                  << std::setw(9) << totalBbbv / count
+                  << std::setw(8) << (games > 0 ? minBbbv : 0)
+                  << std::setw(8) << maxBbbv
+                  << std::setw(10) << totalOpenings / count
+                  << std::setw(10) << totalIsolated / count
+                  << std::setw(9) << totalClicks / count
+                  << std::setw(12) << std::setprecision(0) << (seconds > 0.0 ? totalBbbv / seconds : 0.0)
+                  << std::setw(14) << (sink >= 0 && scoring > 0.0 ? rounds / scoring : 0.0) << '\n';
+    }
+    std::cout.flush();
+}
+
+inline void Benchmark::adjacency(const std::string& size, int maxThreads) {
+    int width, height;
+    if (!parseSize(size, width, height)) {
+        std::cout << "Invalid size '" << size << "' (expected WxH)" << '\n';
+        return;
+    }
+    if (static_cast<long long>(width) * height < Board::PARALLEL_MIN_CELLS) {
+        std::cout << "Note: boards under " << Board::PARALLEL_MIN_CELLS << " cells always run serially" << '\n';
+    }
+    const int mines = static_cast<int>(static_cast<long long>(width) * height / 5);
+    Board board(width, height, mines, 1);
+    board.placeMines(0, 0);
+
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(std::max(1, maxThreads));
+
+    std::ostringstream header;
+    header << std::setw(8) << "threads" << std::setw(12) << "ms" << std::setw(12) << "Mcells/s"
+           << std::setw(10) << "speedup" << std::setw(12) << "efficiency";
+    std::cout << size << ", " << width * static_cast<long long>(height) << " cells" << '\n';
+    std::cout << header.str() << '\n';
+    std::cout << std::string(header.str().size(), '-') << '\n';
+
+    double baseline = 0.0;
+    for (const int threads : threadCounts) {
+        ThreadPool pool(threads - 1);
+        board.setThreadPool(&pool);
+        // Best of three runs
+        double best = std::numeric_limits<double>::max();
+        for (int run = 0; run < 3; ++run) {
+            const auto begin = std::chrono::steady_clock::now();
+            board.calculateAdjacentMines();
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+        }
+        board.setThreadPool(nullptr);
+        if (threads == 1) {
+            baseline = best;
+        }
+        const double speedup = baseline / best;
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(1)
+                  << std::setw(12) << best * 1000.0
+                  << std::setw(12) << static_cast<double>(width) * height / best / 1e6
+                  << std::setw(10) << std::setprecision(2) << speedup
+                  << std::setw(11) << std::setprecision(0) << 100.0 * speedup / threads << "%" << '\n';
+    }
+
+    // The adjacency pass is one of three phases of initializeMines(); mine
+    // placement and opening labelling run on one thread, so the end-to-end time
+    // is what a session waits for. Labelling is the total minus the two others.
+    ThreadPool pool(std::max(1, maxThreads) - 1);
+    using Clock = std::chrono::steady_clock;
+    auto milliseconds = [](Clock::duration elapsed) { return std::chrono::duration<double, std::milli>(elapsed).count(); };
+    Board phases(width, height, mines, 2);
+    phases.setThreadPool(&pool);
+    const auto start = Clock::now();
+    phases.placeMines(0, 0);
+    const auto placed = Clock::now();
+    phases.calculateAdjacentMines();
+    const auto counted = Clock::now();
+    Board whole(width, height, mines, 2);
+    whole.setThreadPool(&pool);
+    const auto begin = Clock::now();
+    whole.initializeMines(0, 0);
+    const double total = milliseconds(Clock::now() - begin);
+    const double placement = milliseconds(placed - start), adjacency = milliseconds(counted - placed);
+    std::cout << '\n' << "Generation with " << std::max(1, maxThreads) << " threads: " << std::fixed << std::setprecision(1)
+              << total << " ms end to end (placement " << placement << " ms, adjacency " << adjacency
+              << " ms, opening labels " << std::max(0.0, total - placement - adjacency) << " ms)" << '\n';
+    std::cout.flush();
+}
+
+inline void Benchmark::revealIndex(int width) {
+    using Clock = std::chrono::steady_clock;
+    const int rows = std::max(1, (1 << 22) / std::max(1, width));
+    const double reveals = static_cast<double>(rows) * ((width + 1) / 2);
+    RevealIndex index(rows);
+    auto nanoseconds = [&](Clock::time_point begin) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / reveals;
+    };
+    auto begin = Clock::now();
+    for (int x = 0; x < rows; ++x) {
+        for (int y = 0; y < width; y += 2) {
+            index.onReveal(x, y);
+        }
+    }
+    const double append = nanoseconds(begin);
+    index.reset();
+    begin = Clock::now();
+    for (int x = 0; x < rows; ++x) {
+        for (int y = (width - 1) & ~1; y >= 0; y -= 2) {
+            index.onReveal(x, y);
+        }
+    }
+    const double insert = nanoseconds(begin);
+    begin = Clock::now();
+    for (int x = 0; x < rows; ++x) {
+        for (int y = 1; y < width; y += 2) {
+            index.onReveal(x, y);
+        }
+    }
+    const double join = nanoseconds(begin);
+    std::cout << width << " columns, checkerboard rows of " << (width + 1) / 2 << " runs: " << std::fixed
+              << std::setprecision(1) << append << " ns per appended run, " << insert << " ns per run started in front, "
+              << join << " ns per join in front" << '\n';
+    std::cout.flush();
+}
+
+inline int Benchmark::startCacheMisses() {
+    // Per-thread hardware counter, or -1 when it cannot be opened
+#ifdef __linux__
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int counter = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (counter >= 0) {
+        ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    return counter;
+#else
+    return -1;
+#endif
+}
+
+inline long long Benchmark::stopCacheMisses(int counter) {
+    // Misses counted since startCacheMisses(), or -1 when unavailable
+#ifdef __linux__
+    if (counter < 0) {
+        return -1;
+    }
+    ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+    long long misses = 0;
+    const bool ok = read(counter, &misses, sizeof(misses)) == static_cast<ssize_t>(sizeof(misses));
+    close(counter);
+    return ok ? misses : -1;
+#else
+    (void)counter;
+    return -1;
+#endif
+}
+
+template <class Layout>
+inline void Benchmark::layoutRun(const char* name, int width, int height, std::span<const std::pair<int, int>> mines) {
+    ThreadPool serial(0);
+    BasicBoard<Layout> board(width, height, static_cast<int>(mines.size()));
+    board.setThreadPool(&serial);
+    board.loadMines(mines);
+    const double cells = static_cast<double>(width) * height;
+    auto print = [&](double seconds, long long misses) {
+        std::cout << std::setw(12) << std::fixed << std::setprecision(1) << seconds * 1000.0;
+        if (misses < 0) {
+            std::cout << std::setw(14) << "n/a" << std::setw(12) << "n/a";
+        } else {
+            std::cout << std::setw(14) << misses << std::setw(12) << std::setprecision(3) << misses / cells;
+        }
+    };
+
+    std::cout << std::left << std::setw(10) << name << std::right;
+    int counter = startCacheMisses();
+    auto begin = std::chrono::steady_clock::now();
+    board.calculateAdjacentMines();
+    print(std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(), stopCacheMisses(counter));
+
+    // A one-cell rectangle opens through the breadth-first fill rather than the
+    // precomputed opening lists
+    int minesHit = 0;
+    counter = startCacheMisses();
+    begin = std::chrono::steady_clock::now();
+    board.revealRect(height / 2, width / 2, height / 2, width / 2, minesHit);
+    print(std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(), stopCacheMisses(counter));
+    std::cout << std::setw(12) << board.getRevealedCount() << '\n';
+}
+
+inline void Benchmark::layout(const std::string& size) {
+    int width, height;
+    if (!parseSize(size, width, height)) {
+        std::cout << "Invalid size '" << size << "' (expected WxH)" << '\n';
+        return;
+    }
+    // One mine per hundred cells, none around the center, so the fill from the
+    // center opens most of the board
+    std::mt19937 rng(1);
+    std::vector<std::pair<int, int>> mines;
+    const long long count = static_cast<long long>(width) * height / 100;
+    for (long long k = 0; k < count; ++k) {
+        const int x = static_cast<int>(rng() % height), y = static_cast<int>(rng() % width);
+        if (std::abs(x - height / 2) > 1 || std::abs(y - width / 2) > 1) {
+            mines.push_back({x, y});
+        }
+    }
+
+    std::ostringstream header;
+    header << std::left << std::setw(10) << "layout" << std::right
+           << std::setw(12) << "count ms" << std::setw(14) << "misses" << std::setw(12) << "per cell"
+           << std::setw(12) << "fill ms" << std::setw(14) << "misses" << std::setw(12) << "per cell"
+           << std::setw(12) << "revealed";
+    std::cout << size << ", " << width * static_cast<long long>(height) << " cells" << '\n';
+    std::cout << header.str() << '\n';
+    std::cout << std::string(header.str().size(), '-') << '\n';
+    layoutRun<RowMajorLayout>("row-major", width, height, mines);
+    layoutRun<TiledLayout<16>>("tiled 16", width, height, mines);
+    std::cout.flush();
+}
+
+template <int D>
+inline void Benchmark::ndRun(const typename NdBoard<D>::Point& extents) {
+    long long cells = 1;
+    std::string name;
+    typename NdBoard<D>::Point center;
+    for (int k = 0; k < D; ++k) {
+        cells *= extents[k];
+        name += (k > 0 ? "x" : "") + std::to_string(extents[k]);
+        center[k] = extents[k] / 2;
+    }
+    NdBoard<D> board(extents, static_cast<int>(cells / 100), 1);
+    auto begin = std::chrono::steady_clock::now();
+    board.initializeMines(center);
+    const double generation = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    begin = std::chrono::steady_clock::now();
+    board.revealCell(center);
+    const double fill = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    std::cout << std::left << std::setw(18) << name << std::right << std::setw(12) << cells
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << generation * 1000.0 << std::setw(12) << cells / generation / 1e6
+              << std::setw(12) << fill * 1000.0 << std::setw(12) << board.getRevealedCount() / fill / 1e6
+              << std::setw(12) << board.getRevealedCount() << '\n';
+}
+
+inline void Benchmark::ndBoard(int size) {
+    std::ostringstream header;
+    header << std::left << std::setw(18) << "board" << std::right << std::setw(12) << "cells"
+           << std::setw(12) << "gen ms" << std::setw(12) << "Mcells/s"
+           << std::setw(12) << "fill ms" << std::setw(12) << "Mcells/s" << std::setw(12) << "revealed";
+    std::cout << header.str() << '\n';
+    std::cout << std::string(header.str().size(), '-') << '\n';
+    ndRun<3>({size, size, size});
+    const int edge = std::max(1, static_cast<int>(std::lround(std::pow(size, 0.75))));
+    ndRun<4>({edge, edge, edge, edge});
+    std::cout.flush();
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Metrics.h"
+#include "SplitMix64.h"
+using namespace std;
+
+// Dedicated engine for 8x8 boards (the BEGINNER preset).
+// Mines, revealed and flagged cells are single 64-bit words with bit x * 8 + y
+// for row x and column y. Adjacent counts are four bit planes produced by a
+// bit-sliced add of the eight shifted mine masks, flood fill is an iterated
+// dilation masked by the zero cells, and the win check is one compare.
+class BitBoard8 {
+public:
+    static constexpr int SIZE = 8;
+
+    BitBoard8(int mineCount, uint64_t seed);
+
+    void reset();
+    bool isInitialized() const;
+    void placeMines(int firstClickX, int firstClickY);
+    // Use a layout made elsewhere (bit x * 8 + y set for a mine)
+    void loadMines(uint64_t mines);
+
+    // Reveal every hidden, unflagged cell of mask and flood fill from the zero
+    // cells among them; returns the mask of newly revealed cells
+    uint64_t reveal(uint64_t mask, int& minesHit);
+    // Chord on (x, y) with the rules of Board::chordCell; returns the newly revealed cells
+    uint64_t chord(int x, int y, int& minesHit);
+    bool toggleFlag(int x, int y);
+    // Flag every hidden cell of mask; returns the newly flagged cells
+    uint64_t flag(uint64_t mask);
+
+    bool isWon() const;
+    int getAdjacentMines(int x, int y) const;
+    uint64_t getMines() const;
+    uint64_t getRevealed() const;
+    uint64_t getFlagged() const;
+
+    static bool isValidPosition(int x, int y);
+    static uint64_t bit(int x, int y);
+    static uint64_t neighbours(uint64_t cells);
+
+private:
+    void calculateAdjacentMines();
+
+    static constexpr uint64_t FIRST_COLUMN = 0x0101010101010101ULL;
+    static constexpr uint64_t LAST_COLUMN = 0x8080808080808080ULL;
+
+    int m_mineCount;
+    bool m_initialized;
+    uint64_t m_rng;
+    uint64_t m_mines;
+    uint64_t m_revealed;
+    uint64_t m_flagged;
+    uint64_t m_zero;
+    uint64_t m_count[4];
+};
+
+inline BitBoard8::BitBoard8(int mineCount, uint64_t seed)
+    : m_mineCount(std::clamp(mineCount, 0, SIZE * SIZE - 1))
+    , m_initialized(false)
+    , m_rng(seed)
+    , m_mines(0)
+    , m_revealed(0)
+    , m_flagged(0)
+    , m_zero(0)
+    , m_count{0, 0, 0, 0}
+{
+}
+
+inline void BitBoard8::reset() {
+    m_initialized = false;
+    m_mines = 0;
+    m_revealed = 0;
+    m_flagged = 0;
+    m_zero = 0;
+    std::fill(std::begin(m_count), std::end(m_count), 0);
+}
+
+inline bool BitBoard8::isInitialized() const {
+    return m_initialized;
+}
+
+inline bool BitBoard8::isValidPosition(int x, int y) {
+    return x >= 0 and x < SIZE and y >= 0 and y < SIZE;
+}
+
+inline uint64_t BitBoard8::bit(int x, int y) {
+    return 1ULL << (x * SIZE + y);
+}
+
+inline uint64_t BitBoard8::neighbours(uint64_t cells) {
+    // Dilation by one cell in all eight directions; columns must not wrap
+    const uint64_t east = (cells << 1) & ~FIRST_COLUMN;
+    const uint64_t west = (cells >> 1) & ~LAST_COLUMN;
+    const uint64_t row = cells | east | west;
+    return ((row << SIZE) | (row >> SIZE) | east | west);
+}
+
+inline void BitBoard8::placeMines(int firstClickX, int firstClickY) {
+    // Uniform choice of m_mineCount cells among the other 63 (partial Fisher-Yates),
+    // then the adjacent counts
+    const auto begin = std::chrono::steady_clock::now();
+    const int excluded = firstClickX * SIZE + firstClickY;
+    uint8_t positions[SIZE * SIZE];
+    int available = 0;
+    for (int cell = 0; cell < SIZE * SIZE; ++cell)
+    {
+        if (cell != excluded)
+            positions[available++] = static_cast<uint8_t>(cell);
+    }
+    m_mines = 0;
+    for (int i = 0; i < m_mineCount; ++i)
+    {
+        const int pick = i + static_cast<int>(SplitMix64::below(m_rng, static_cast<uint64_t>(available - i)));
+        std::swap(positions[i], positions[pick]);
+        m_mines |= 1ULL << positions[i];
+    }
+    calculateAdjacentMines();
+    m_initialized = true;
+    Metrics::add(Metrics::BOARDS_GENERATED);
+    Metrics::observe(Metrics::GENERATION_LATENCY, std::chrono::steady_clock::now() - begin);
+}
+
+inline void BitBoard8::loadMines(uint64_t mines) {
+    reset();
+    m_mines = mines;
+    calculateAdjacentMines();
+    m_initialized = true;
+}
+
+inline void BitBoard8::calculateAdjacentMines() {
+    // Add the eight shifted mine masks into four bit planes (a bit-sliced counter)
+    const uint64_t east = (m_mines << 1) & ~FIRST_COLUMN;
+    const uint64_t west = (m_mines >> 1) & ~LAST_COLUMN;
+    const uint64_t shifted[8] = {
+        m_mines << SIZE, m_mines >> SIZE, east, west,
+        east << SIZE, east >> SIZE, west << SIZE, west >> SIZE,
+    };
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (const uint64_t in : shifted)
+    {
+        const uint64_t c0 = s0 & in;
+        s0 ^= in;
+        const uint64_t c1 = s1 & c0;
+        s1 ^= c0;
+        const uint64_t c2 = s2 & c1;
+        s2 ^= c1;
+        s3 |= c2;
+    }
+    m_count[0] = s0;
+    m_count[1] = s1;
+    m_count[2] = s2;
+    m_count[3] = s3;
+    m_zero = ~(s0 | s1 | s2 | s3) & ~m_mines;
+}
+
+inline uint64_t BitBoard8::reveal(uint64_t mask, int& minesHit) {
+    // Same cells as Board::floodFill: neighbours of newly revealed zero cells
+    // are opened unless they are mines, flagged or already revealed
+    mask &= ~m_revealed & ~m_flagged;
+    minesHit = std::popcount(mask & m_mines);
+    m_revealed |= mask;
+    uint64_t opened = mask;
+    uint64_t frontier = mask & m_zero;
+    while (frontier)
+    {
+        const uint64_t next = neighbours(frontier) & ~m_mines & ~m_flagged & ~m_revealed;
+        m_revealed |= next;
+        opened |= next;
+        frontier = next & m_zero;
+    }
+    Metrics::add(Metrics::FLOOD_FILL_CELLS, std::popcount(opened & ~mask));
+    return opened;
+}
+
+inline uint64_t BitBoard8::chord(int x, int y, int& minesHit) {
+    minesHit = 0;
+    const uint64_t center = bit(x, y);
+    const int number = getAdjacentMines(x, y);
+    if (!(m_revealed & center) or (m_mines & center) or number == 0)
+        return 0;
+    const uint64_t around = neighbours(center) & ~center;
+    if (std::popcount(around & m_flagged) != number)
+        return 0;
+    return reveal(around, minesHit);
+}
+
+inline bool BitBoard8::toggleFlag(int x, int y) {
+    const uint64_t cell = bit(x, y);
+    if (m_revealed & cell)
+        return false;
+    m_flagged ^= cell;
+    return true;
+}
+
+inline uint64_t BitBoard8::flag(uint64_t mask) {
+    const uint64_t flagged = mask & ~m_revealed & ~m_flagged;
+    m_flagged |= flagged;
+    return flagged;
+}
+
+inline bool BitBoard8::isWon() const {
+    // Every non-mine cell revealed
+    return m_initialized and (m_revealed | m_mines) == ~0ULL;
+}
+
+inline int BitBoard8::getAdjacentMines(int x, int y) const {
+    const int shift = x * SIZE + y;
+    return static_cast<int>(((m_count[0] >> shift) & 1) | (((m_count[1] >> shift) & 1) << 1) |
+                            (((m_count[2] >> shift) & 1) << 2) | (((m_count[3] >> shift) & 1) << 3));
+}
+
+inline uint64_t BitBoard8::getMines() const {
+    return m_mines;
+}
+
+inline uint64_t BitBoard8::getRevealed() const {
+    return m_revealed;
+}
+
+inline uint64_t BitBoard8::getFlagged() const {
+    return m_flagged;
+}
@@ -2,13 +2,50 @@
 
 #include <bits/stdc++.h>
 #include "Cell.h" // Include to use std::logic_error
+#include "Metrics.h"
+#include "Minimap.h"
+#include "RevealIndex.h"
+#include "BoardDelta.h"
+#include "ThreadPool.h"
+#include "BoardLayout.h"
+#include "BoardTopology.h"
 using namespace std;
 
 
-class Board {
+// Layout decides where each cell is stored (BoardLayout.h) and Topology which
+// cells are neighbours (BoardTopology.h); Board is the row-major, eight
+// neighbour default. The board keeps its own copies of the layout and the
+// topology, so either may carry parameters (NdLayout and NdTopology their extents).
+// Cells store adjacent counts in four bits, so on topologies of DEGREE 15 and
+// up a cell holds its count saturated at MAX_STORED_ADJACENT, which keeps zero
+// tests exact, and the board keeps the exact counts aside: getAdjacentMines().
+// The visible-state APIs (readRegion() and the text renderers) encode counts up
+// to 8 only, so they exist on topologies of DEGREE 8 and below. Openings are
+// listed on those topologies only, see labelOpenings().
+template <class Layout, class Topology = StandardTopology>
+class BasicBoard {
 public:
-    Board(int width, int height, int mineCount);
-    ~Board();
+    static_assert(!Topology::LAYOUT_NEIGHBOURS or Layout::NEIGHBOURS == Topology::DEGREE,
+                  "a topology taking its neighbours from the layout needs a layout with as many");
+
+    // Exact byte breakdown of a board's footprint
+    struct MemoryUsage {
+        size_t object;   // sizeof(BasicBoard), includes the inline RNG state
+        size_t rng;      // RNG state (already counted in object)
+        size_t rows;     // heap blocks of per-row bookkeeping (unresolved counts, and the reveal index when enabled)
+        size_t grid;     // heap block holding the cells, sentinel border included, and the exact counts of high-DEGREE topologies
+        size_t scratch;  // persistent scratch buffers
+
+        size_t total() const { return object + rows + grid + scratch; }
+    };
+
+    BasicBoard(int width, int height, int mineCount);
+    // Same with a fixed seed for the mine placement, for reproducible layouts
+    BasicBoard(int width, int height, int mineCount, uint64_t seed);
+    // Same with a layout and a topology that carry parameters
+    BasicBoard(int width, int height, int mineCount, uint64_t seed, const Layout& layout, const Topology& topology);
+    // Every buffer is a vector or unique_ptr member and frees itself
+    ~BasicBoard() = default;
     bool revealCell(int x, int y);
     bool toggleFlag(int x, int y);
     void initializeMines(int firstClickX, int firstClickY);
@@ -16,8 +53,12 @@ public:
     bool isGameLost() const; 
     bool isMineAt(int x, int y) const;
     int getRevealedMineCount() const;
-    void display() const; 
-    void displayDebug();
+    void display() const requires (Topology::DEGREE <= 8);
+    void displayDebug() requires (Topology::DEGREE <= 8);
+    std::string formatBoard(bool showAll) const requires (Topology::DEGREE <= 8);
+    std::string formatRegion(int x0, int y0, int rows, int cols, bool showAll) const requires (Topology::DEGREE <= 8);
+    size_t renderSize(bool spaced = false) const requires (Topology::DEGREE <= 8);
+    size_t renderRows(std::span<char> out, bool spaced = false) const requires (Topology::DEGREE <= 8);
     int getWidth() const;
     int getHeight() const;
     int getMineCount() const;
@@ -30,47 +71,197 @@ public:
     void placeMines(int excludeX, int excludeY);
     void calculateAdjacentMines();
     int countAdjacentMines(int x, int y) const;
+    int getAdjacentMines(int x, int y) const;
     void revealAdjacentCells(int x, int y); 
+    bool chordCell(int x, int y, int& minesHit);
+    int revealCells(std::span<const std::pair<int, int>> cells, int& minesHit);
+    int revealRect(int x0, int y0, int x1, int y1, int& minesHit);
+    int flagCells(std::span<const std::pair<int, int>> cells);
+    int flagRect(int x0, int y0, int x1, int y1);
     std::vector<std::pair<int, int>> getAdjacentPositions(int x, int y) const;
+    MemoryUsage memoryUsage() const;
+    void enableMinimap(int tileSize);
+    const Minimap* getMinimap() const;
+    void enableRevealIndex();
+    const RevealIndex* getRevealIndex() const;
+    void setDelta(BoardDelta* delta);
+    bool readRegion(int x0, int y0, int rows, int cols, std::span<uint8_t> out) const requires (Topology::DEGREE <= 8);
+    std::span<const Cell> rowView(int x) const requires Layout::CONTIGUOUS_ROWS;
+    void loadMines(std::span<const std::pair<int, int>> mines);
+    void syncCell(int x, int y, Cell::State state);
+    int getOpeningCount() const;
+    int getIsolatedNumberCount() const;
+    void setThreadPool(ThreadPool* pool);
+    void setParallel(bool parallel);
+    int getUnresolvedInRow(int x) const;
+    int getUnresolvedInTile(int tileRow, int tileCol) const;
+    bool nextUnresolved(int& x, int& y) const;
+
+    // Boards from this size on run large openings on the thread pool
+    static constexpr int PARALLEL_MIN_CELLS = 1 << 20;
+    // A fill on such a board goes parallel only after this many cells were
+    // expanded serially, and only while this many cells wait in its frontier
+    static constexpr int PARALLEL_FILL_PREFIX = 1 << 14;
+    static constexpr int PARALLEL_MIN_FRONTIER = 1 << 12;
+    // Side of the square tiles unresolved cells are counted per, see getUnresolvedInTile()
+    static constexpr int UNRESOLVED_TILE = 64;
+    // Largest adjacent count a cell stores, see the class comment
+    static constexpr int MAX_STORED_ADJACENT = 14;
 
 private:
+    int index(int x, int y) const;
+    int rowOf(int32_t c) const;
+    int columnOf(int32_t c) const;
+    void labelOpenings();
+    int32_t openingOf(int32_t c) const;
+    int32_t zeroRank(int32_t c) const;
+    bool openRegion(int x, int y);
+    void floodFill(vector<int32_t>& frontier);
+    void parallelFloodFill(vector<int32_t>& frontier);
+    void noteRevealedCells(const vector<vector<int32_t>>& lists);
+    template <class Visit>
+    void forEachNeighbour(int32_t c, Visit&& visit) const;
+    void readMineRow(int x, uint8_t* out) const;
+    void countBand(int x0, int x1, uint8_t* rows);
+    ThreadPool* parallelPool() const;
+    bool openCell(int32_t c, vector<int32_t>& frontier, int& minesHit);
+    void noteReveal(int x, int y, bool mine);
+    void notifyReveal(int x, int y, bool mine);
+    void noteFlag(int x, int y, bool flagged);
+    int unresolvedTile(int x, int y) const;
+    void countUnresolved();
+    void resolveConcurrently(std::span<const int32_t> cells);
+    char* renderRow(int x, int y0, int y1, char* out, bool spaced, bool showAll) const requires (Topology::DEGREE <= 8);
+    template <class Hidden, class Revealed>
+    void forEachSpan(int x, int y0, int y1, Hidden&& hidden, Revealed&& revealed) const;
+
     int m_width;
     int m_height;
     int m_mineCount;
     int m_flagCount;
     int m_revealedCount;
+    int m_revealedMineCount;
     bool m_initialized;
     std::mt19937 m_rng;
-    vector<vector<Cell>> m_grid;
+    std::unique_ptr<Minimap> m_minimap;
+    std::unique_ptr<RevealIndex> m_revealIndex;
+    BoardDelta* m_delta;
+    ThreadPool* m_pool;
+    bool m_parallel;
+
+    // Cells with a one-cell sentinel border, placed by m_layout, see the constructor
+    Layout m_layout;
+    vector<Cell> m_cells;
+    Topology m_topology;
+
+    // Exact adjacent counts by cell index where a Cell cannot hold them (DEGREE
+    // above MAX_STORED_ADJACENT), filled by calculateAdjacentMines(); empty otherwise
+    using WideCount = std::conditional_t<(Topology::DEGREE < 256), uint8_t, uint16_t>;
+    vector<WideCount> m_adjacent;
+
+    // Border cells are revealed non-mines with an adjacent count no real cell
+    // can have, so they are never taken for zero cells either
+    static constexpr int SENTINEL_ADJACENT = 15;
+
+    // Openings computed at generation time, see labelOpenings()
+    // Cells are identified by their index into m_cells
+    vector<uint64_t> m_zeroMask;     // per 64 cells: a bit for each zero cell
+    vector<int32_t> m_zeroRank;      // per word of m_zeroMask: zero cells in the words before it
+    vector<int32_t> m_zeroOpening;   // per zero cell, in m_cells order: its opening
+    vector<int32_t> m_openingStart;  // per opening: offset into m_openingCells, plus an end marker
+    vector<int32_t> m_openingCells;  // zero cells of every opening
+    vector<int32_t> m_borderStart;   // per opening: offset into m_borderCells, plus an end marker
+    vector<int32_t> m_borderCells;   // numbered border of every opening
+    int m_isolatedCount;             // numbered cells on no opening's border
+
+    // Cells claimed by parallelFloodFill(), one byte per cell, allocated on first use
+    vector<uint8_t> m_claimed;
+
+    // Scratch kept across calls so moves and generations reuse its capacity:
+    // the flood fill queue, the mine rows of countBand() (five per band: halo
+    // above, halo below and three rolling rows) and the per-task cell lists of
+    // the parallel paths
+    vector<int32_t> m_frontier;
+    vector<uint8_t> m_bandRows;
+    vector<vector<int32_t>> m_taskCells;
+    vector<size_t> m_taskZeros;
+
+    // Unresolved cells (hidden or flagged non-mines) per row and per
+    // UNRESOLVED_TILE square tile, row-major; every reveal of a non-mine takes
+    // one off both. Scans skip the rows and tiles that reach zero.
+    vector<int32_t> m_unresolvedRows;
+    vector<int32_t> m_unresolvedTiles;
 };
 
-inline Board::Board(int width, int height, int mineCount)
+using Board = BasicBoard<RowMajorLayout>;
+
+template <class Layout, class Topology>
+inline BasicBoard<Layout, Topology>::BasicBoard(int width, int height, int mineCount)
+    : BasicBoard(width, height, mineCount, std::random_device{}())
+{
+}
+
+template <class Layout, class Topology>
+inline BasicBoard<Layout, Topology>::BasicBoard(int width, int height, int mineCount, uint64_t seed)
+    : BasicBoard(width, height, mineCount, seed, Layout(width, height), Topology())
+{
+}
+
+template <class Layout, class Topology>
+inline BasicBoard<Layout, Topology>::BasicBoard(int width, int height, int mineCount, uint64_t seed,
+                                                const Layout& layout, const Topology& topology)
     : m_width(width)
     , m_height(height)
     , m_mineCount(mineCount)
     , m_flagCount(0)
     , m_revealedCount(0)
+    , m_revealedMineCount(0)
     , m_initialized(false)
-    , m_rng(std::random_device{}())
+    , m_rng(static_cast<uint32_t>(seed ^ (seed >> 32)))
+    , m_delta(nullptr)
+    , m_pool(nullptr)
+    , m_parallel(true)
+    , m_layout(layout)
+    , m_topology(topology)
+    , m_isolatedCount(0)
 {
-    // TODO: Initialize the m_grid with proper dimensions
-    // Hint: m_grid should be a 2D vector of size height x width
-    m_grid.resize(m_height);
-    for (int i = 0; i < m_width; ++i) {
-        m_grid[i].resize(m_width);
-        for (int j = 0; j < m_width; ++j) 
-        {
-            m_grid[i][j] = Cell();
-        }
+    // The cells live in one block arranged by the layout: the board plus a
+    // one-cell sentinel border. Neighbour loops take a cell's neighbours from
+    // m_layout without any bounds check, since the border cells are never
+    // mines and already revealed. Every cell starts as border and the board's
+    // own cells are cleared, which covers any padding the layout adds.
+    Cell border;
+    border.setAdjacentMines(SENTINEL_ADJACENT);
+    border.reveal();
+    m_cells.assign(m_layout.size(), border);
+    for (int i = 0; i < m_height; ++i)
+    {
+        for (int j = 0; j < m_width; ++j)
+            m_cells[index(i, j)].reset();
     }
+    countUnresolved();
 }
-    
-inline Board::~Board() {
-    // TODO: Implement destructor if needed (currently no dynamic allocation)
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::index(int x, int y) const {
+    // Index into m_cells of board position (x, y); -1 and width/height address the border
+    return m_layout.index(x, y);
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::rowOf(int32_t c) const {
+    return m_layout.row(c);
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::columnOf(int32_t c) const {
+    return m_layout.column(c);
 }
 
-inline bool Board::revealCell(int x, int y) {
-    // TODO: Implement cell revealing logic
+    
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::revealCell(int x, int y) {
+    // Reveal a single cell
     // 1. Check if position is valid using isValidPosition()
     // 2. Get the cell at position (x, y)
     // 3. Check if cell is already revealed or flagged - return false if so
@@ -79,180 +270,289 @@ inline bool Board::revealCell(int x, int y) {
     // 6. If cell is a mine, return false (with lives system, let Game class handle life loss)
     // 7. If cell has no adjacent mines, call revealAdjacentCells(x, y)
     // 8. Return true on success
-
-    throw std::logic_error("revealCell() function is not yet implemented");
+    if (!isValidPosition(x, y))
+        return false;
+    Cell& cell = m_cells[index(x, y)];
+    if (cell.isRevealed() or cell.isFlagged())
+        return false;
+    if (!m_initialized)
+    {
+        initializeMines(x, y);
+        m_initialized = true;
+    }
+    cell.reveal();
+    m_revealedCount += 1;
+    noteReveal(x, y, cell.isMine());
+    if (cell.isMine())
+        return false;
+    if (cell.getAdjacentMines() == 0)
+        revealAdjacentCells(x, y);
+    return true;
 }
 
-inline bool Board::toggleFlag(int x, int y) {
-    // TODO: Implement flag toggling logic
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::toggleFlag(int x, int y) {
+    // Toggle the flag on a hidden cell
     // 1. Check if position is valid
     // 2. Get the cell at position (x, y)
     // 3. Check if cell is already revealed - return false if so
     // 4. Toggle the flag on the cell
     // 5. Update m_flagCount accordingly (increment if flagged, decrement if unflagged)
     // 6. Return true on success
-    throw std::logic_error("toggleFlag() function is not yet implemented");
+    if (!isValidPosition(x, y))
+        return false;
+    Cell& cell = m_cells[index(x, y)];
+    if (cell.isRevealed())
+        return false;
+    cell.toggleFlag();
+    m_flagCount += cell.isFlagged() ? 1 : -1;
+    noteFlag(x, y, cell.isFlagged());
+    return true;
 }
 
-inline void Board::initializeMines(int firstClickX, int firstClickY) {
-    // TODO: Initialize mines on the board
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::initializeMines(int firstClickX, int firstClickY) {
+    // Initialize mines on the board
     // 1. Call placeMines(firstClickX, firstClickY) to place mines
     // 2. Call calculateAdjacentMines() to calculate adjacent mine counts
-    throw std::logic_error("initializeMines() function is not yet implemented");
+    // 3. Record the generation in the metrics (count and latency)
+    // The board counts as started from here, whoever calls it
+    const auto begin = std::chrono::steady_clock::now();
+    placeMines(firstClickX, firstClickY);
+    calculateAdjacentMines();
+    labelOpenings();
+    m_initialized = true;
+    Metrics::add(Metrics::BOARDS_GENERATED);
+    Metrics::observe(Metrics::GENERATION_LATENCY, std::chrono::steady_clock::now() - begin);
 }
 
-inline bool Board::isGameWon() const {
-    // TODO: Check if game is won
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::isGameWon() const {
+    // Check if game is won
     // Game is won when all non-mine cells are revealed
     // With lives system, we need to account for revealed mines:
-    // 1. Calculate total cells and non-mine cells
-    // 2. Get count of revealed mines using getRevealedMineCount()
-    // 3. Calculate revealed non-mine cells (m_revealedCount - revealed mines)
-    // 4. Return true if all non-mine cells are revealed
-    int cnt = 0, nonMine = 0;
-    int n = getHeight();
-    int m = getWidth();
-    for(int i = 0; i < n; ++i)
-    {
-        for (int j = 0 ; i < m; ++j)
-        {
-            if(m_grid[i][j].isRevealed())
-                cnt += 1;
-            if(!m_grid[i][j].isMine())
-                nonMine += 1;
-        }
-    }
-    return nonMine == (cnt - getRevealedMineCount());
-    
+    // 1. Non-mine cells are the total cells minus the mines
+    // 2. Revealed non-mine cells are m_revealedCount minus the revealed mines
+    // 3. Return true if all non-mine cells are revealed
+    // Both counts are maintained by the mutations, so this is O(1)
+    const int nonMine = getWidth() * getHeight() - m_mineCount;
+    return m_initialized and (m_revealedCount - m_revealedMineCount) == nonMine;
 }
 
-inline bool Board::isGameLost() const {
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::isGameLost() const {
     // Check if game is lost
     // Game is lost when any revealed cell contains a mine
-    // Loop through all cells and check if any revealed cell is a mine
     // NOTE: With lives system, this method may not be used as game continues after mine hits
-    int n = getHeight();
-    int m = getWidth();
-    for(int i = 0; i < n; ++i)
-    {
-        for (int j = 0 ; i < m; ++j)
-        {
-            if(m_grid[i][j].isRevealed() and m_grid[i][j].isMine())
-                return true;
-        }
-    }
-    return false;
+    return m_revealedMineCount > 0;
 }
 
-inline bool Board::isMineAt(int x, int y) const {
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::isMineAt(int x, int y) const {
     // Check if there's a mine at specific position (for lives system)
     // 1. Check if position is valid using isValidPosition()
     // 2. Return whether the cell at (x, y) contains a mine
     if (isValidPosition(x, y))
     {
-        return m_grid[x][y].isMine();
+        return m_cells[index(x, y)].isMine();
     }
     return false;
 }
 
-inline int Board::getRevealedMineCount() const {
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getRevealedMineCount() const {
     // Count revealed mines (for lives system win condition)
-    // 1. Loop through all cells in the grid
-    // 2. Count cells that are both revealed AND contain mines
-    // 3. Return the count
     // This is needed because with lives system, mines can be revealed without ending game
-    
-    int cnt = 0;
-    int n = getHeight();
-    int m = getWidth();
-    for(int i = 0; i < n; ++i)
-    {
-        for (int j = 0 ; i < m; ++j)
-        {
-            if(m_grid[i][j].isRevealed() and m_grid[i][j].isMine())
-                cnt += 1;
-        }
-    }
-    return cnt;
+    // Kept up to date by every reveal, see noteReveal()
+    return m_revealedMineCount;
 }
 
-inline void Board::display() const {
-    // TODO: Display the game board
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::display() const requires (Topology::DEGREE <= 8) {
+    // Display the game board
     // 1. Print column headers (numbers 0 to width-1)
     // 2. Print horizontal separator line
     // 3. For each row:
     //    - Print row number
     //    - Print each cell's display character using getDisplayChar()
-    //    - Print horizontal separator after each row
-    // int n = this.getHeight();
-    // int m = this.getWidth();
-    // for(int i = 0; i < m; ++i)
-    // {
-    //     cout << i << " ";
-    // }
-    // cout << endl;
-    // for(int i = 0; i < n; ++i)
-    // {
-    //     for (int j = 0 ; i < m; ++j)
-    //     {
-    //         m_grid[i][j].reset();
-    //     }
-    // }
-    return ;
-}
-
-inline void Board::displayDebug() {
+    // The frame is assembled in one buffer and written once
+    std::cout << formatBoard(false);
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::displayDebug() requires (Topology::DEGREE <= 8) {
     // Display debug view showing all mines
     // Similar to display() but show mines as '*' and adjacent mine counts
     // This helps with debugging and testing
-    int n = getHeight();
-    int m = getWidth();
-    for(int i = 0; i < n; ++i)
+    std::cout << formatBoard(true);
+}
+
+template <class Layout, class Topology>
+inline std::string BasicBoard<Layout, Topology>::formatBoard(bool showAll) const requires (Topology::DEGREE <= 8) {
+    return formatRegion(0, 0, getHeight(), getWidth(), showAll);
+}
+
+template <class Layout, class Topology>
+inline std::string BasicBoard<Layout, Topology>::formatRegion(int x0, int y0, int rows, int cols, bool showAll) const requires (Topology::DEGREE <= 8) {
+    // Format the window of rows x cols cells starting at (x0, y0), clipped to the board
+    // Column headers show the units digit, with a tens row above on wide boards
+    // Only the cells inside the window are touched
+    const int x1 = std::min(getHeight(), x0 + rows);
+    const int y1 = std::min(getWidth(), y0 + cols);
+    const int m = std::max(0, y1 - y0);
+    const int labelWidth = static_cast<int>(std::to_string(std::max(getHeight() - 1, 0)).size()) + 1;
+    std::string out;
+    out.reserve(static_cast<size_t>(std::max(0, x1 - x0) + 3) * (labelWidth + 2 * m + 1));
+    if (getWidth() > 10)
     {
-        for (int j = 0 ; i < m; ++j)
+        out.append(labelWidth, ' ');
+        for (int j = y0; j < y1; ++j)
         {
-            m_grid[i][j].reset();
+            out += j >= 10 ? static_cast<char>('0' + (j / 10) % 10) : ' ';
+            out += ' ';
         }
+        out += '\n';
+    }
+    out.append(labelWidth, ' ');
+    for (int j = y0; j < y1; ++j)
+    {
+        out += static_cast<char>('0' + j % 10);
+        out += ' ';
+    }
+    out += '\n';
+    out.append(labelWidth, ' ');
+    out.append(2 * m, '-');
+    out += '\n';
+    for (int i = x0; i < x1; ++i)
+    {
+        const std::string label = std::to_string(i);
+        out.append(labelWidth - 1 - label.size(), ' ');
+        out += label;
+        out += ' ';
+        // Cells are written in place into the string's storage
+        const size_t offset = out.size();
+        out.resize(offset + 2 * static_cast<size_t>(m) + 1);
+        renderRow(i, y0, y1, out.data() + offset, true, showAll);
     }
+    return out;
 }
 
-inline int Board::getWidth() const {
+template <class Layout, class Topology>
+inline size_t BasicBoard<Layout, Topology>::renderSize(bool spaced) const requires (Topology::DEGREE <= 8) {
+    // Bytes renderRows() needs: one glyph per cell (plus a separator when spaced)
+    // and a newline per row
+    const size_t perCell = spaced ? 2 : 1;
+    return static_cast<size_t>(getHeight()) * (perCell * getWidth() + 1);
+}
+
+template <class Layout, class Topology>
+inline size_t BasicBoard<Layout, Topology>::renderRows(std::span<char> out, bool spaced) const requires (Topology::DEGREE <= 8) {
+    // Serialize the visible board into a caller supplied buffer
+    // No allocation and no iostreams, so it can feed the console, log files or bots
+    // Returns the bytes written, or 0 when out is smaller than renderSize()
+    if (out.size() < renderSize(spaced))
+        return 0;
+    char* cursor = out.data();
+    for (int i = 0; i < getHeight(); ++i)
+    {
+        cursor = renderRow(i, 0, getWidth(), cursor, spaced, false);
+    }
+    return static_cast<size_t>(cursor - out.data());
+}
+
+template <class Layout, class Topology>
+inline char* BasicBoard<Layout, Topology>::renderRow(int x, int y0, int y1, char* out, bool spaced, bool showAll) const requires (Topology::DEGREE <= 8) {
+    // Write the glyphs of columns [y0, y1) of row x followed by a newline
+    // Glyphs come from the packed state lookup table; showAll renders hidden
+    // cells as if revealed (debug view) while keeping flags visible
+    const uint8_t revealedBits = Cell::State::REVEALED << Cell::STATE_SHIFT;
+    if (m_revealIndex and !showAll and m_revealIndex->getFlagCount(x) == 0)
+    {
+        // Without flags in the row an unrevealed span is one glyph repeated,
+        // so only the revealed spans are read
+        const char hidden = Cell::glyph(Cell::State::HIDDEN << Cell::STATE_SHIFT);
+        forEachSpan(x, y0, y1,
+                    [&](int from, int to) {
+                        if (!spaced)
+                        {
+                            out = std::fill_n(out, to - from, hidden);
+                            return;
+                        }
+                        for (int j = from; j < to; ++j)
+                        {
+                            *out++ = hidden;
+                            *out++ = ' ';
+                        }
+                    },
+                    [&](int from, int to) {
+                        for (int j = from; j < to; ++j)
+                        {
+                            *out++ = Cell::glyph(m_cells[index(x, j)].getPacked());
+                            if (spaced)
+                                *out++ = ' ';
+                        }
+                    });
+        *out++ = '\n';
+        return out;
+    }
+    for (int j = y0; j < y1; ++j)
+    {
+        uint8_t packed = m_cells[index(x, j)].getPacked();
+        if (showAll and (packed & Cell::STATE_MASK) == 0)
+            packed |= revealedBits;
+        *out++ = Cell::glyph(packed);
+        if (spaced)
+            *out++ = ' ';
+    }
+    *out++ = '\n';
+    return out;
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getWidth() const {
     // Return width value
     return m_width;
 }
 
-inline int Board::getHeight() const {
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getHeight() const {
     // Return height value
     return m_height;
 }
 
-inline int Board::getMineCount() const {
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getMineCount() const {
     // Return mine count value
     return m_mineCount;
 }
 
-inline int Board::getFlagCount() const {
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getFlagCount() const {
     // Return flag count value
     return m_flagCount;
 }
 
-inline int Board::getRevealedCount() const {
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getRevealedCount() const {
     // Return revealed count value
     return m_revealedCount;
 }
 
-inline Cell& Board::getCell(int x, int y) {
+template <class Layout, class Topology>
+inline Cell& BasicBoard<Layout, Topology>::getCell(int x, int y) {
     // Return reference to cell at position (x, y)
     // Note: Be careful with coordinate system (x, y) vs (row, col)
-    return m_grid[x][y];
+    return m_cells[index(x, y)];
 }
 
-inline const Cell& Board::getCell(int x, int y) const {
+template <class Layout, class Topology>
+inline const Cell& BasicBoard<Layout, Topology>::getCell(int x, int y) const {
     // Return const reference to cell at position (x, y)
-    return m_grid[x][y];
+    return m_cells[index(x, y)];
 }
 
-inline bool Board::isValidPosition(int x, int y) const {
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::isValidPosition(int x, int y) const {
     // Check if position (x, y) is within board bounds
     // Return true if 0 <= x < width and 0 <= y < height
     int n = getHeight();
@@ -260,133 +560,1069 @@ inline bool Board::isValidPosition(int x, int y) const {
     return x >= 0 and x < n and y >= 0 and y < m;
 }
 
-inline void Board::reset() {
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::reset() {
     // Reset the board to initial state
     // 1. Reset m_flagCount and m_revealedCount to 0
     // 2. Set m_initialized to false
     // 3. Reset all cells in the grid using cell.reset()
     m_flagCount = 0;
     m_revealedCount = 0;
+    m_revealedMineCount = 0;
     m_initialized = false;
+    m_zeroMask.clear();
+    m_zeroRank.clear();
+    m_zeroOpening.clear();
+    m_openingStart.clear();
+    m_openingCells.clear();
+    m_borderStart.clear();
+    m_borderCells.clear();
+    m_isolatedCount = 0;
+    m_claimed.clear();
+    if (m_minimap)
+        m_minimap->reset();
+    if (m_revealIndex)
+        m_revealIndex->reset();
     int n = getHeight();
     int m = getWidth();
     for(int i = 0; i < n; ++i)
     {
-        for (int j = 0 ; i < m; ++j)
+        for (int j = 0 ; j < m; ++j)
         {
-            m_grid[i][j].reset();
+            m_cells[index(i, j)].reset();
         }
     }
+    countUnresolved();
 }
 
-inline void Board::placeMines(int excludeX, int excludeY) {
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::placeMines(int excludeX, int excludeY) {
     // Place mines randomly on the board
-    // 1. Create a vector of all possible positions except (excludeX, excludeY)
-    // 2. Shuffle the positions using std::shuffle with m_rng
-    // 3. Place mines on the first m_mineCount positions from shuffled list
-    // 4. Use cell.setMine(true) to mark cells as mines
-    int n = getHeight();
-    int m = getWidth();
-    vector<pair<int, int>> pos;
-    for(int i = 0; i < n; ++i)
+    // A uniform choice of m_mineCount cells among all but (excludeX, excludeY),
+    // by rejection sampling with m_rng: draw cells until enough distinct ones
+    // were taken, which costs O(m_mineCount) instead of shuffling every cell.
+    // Dense layouts start full and draw the safe cells instead, so either way
+    // at most half of the candidates are taken.
+    // The mines come off the unresolved counts as they are placed
+    const int n = getHeight();
+    const int m = getWidth();
+    const long long candidates = static_cast<long long>(n) * m - (isValidPosition(excludeX, excludeY) ? 1 : 0);
+    const long long mines = std::min<long long>(m_mineCount, candidates);
+    const bool dense = mines * 2 > candidates;
+    if (dense)
     {
-        for (int j = 0 ; i < m; ++j)
+        for (int i = 0; i < n; ++i)
         {
-            if (i != excludeX and j != excludeY)
-            {
-                pos.push_back({i, j});
-            }
+            for (int j = 0; j < m; ++j)
+                m_cells[index(i, j)].setMine(i != excludeX or j != excludeY);
         }
     }
-    shuffle(pos.begin(), pos.end(), m_rng);
-    for (int i = 0; i < this->m_mineCount; ++i)
+    std::uniform_int_distribution<long long> pick(0, static_cast<long long>(n) * m - 1);
+    for (long long left = dense ? candidates - mines : mines; left > 0;)
     {
-        m_grid[pos[i].first][pos[i].second].setMine(true);
+        const long long k = pick(m_rng);
+        const int x = static_cast<int>(k / m), y = static_cast<int>(k % m);
+        Cell& cell = m_cells[index(x, y)];
+        if ((x == excludeX and y == excludeY) or cell.isMine() != dense)
+            continue;
+        cell.setMine(!dense);
+        left -= 1;
+        if (!dense and !cell.isRevealed())
+        {
+            m_unresolvedRows[x] -= 1;
+            m_unresolvedTiles[unresolvedTile(x, y)] -= 1;
+        }
     }
+    if (dense)
+        countUnresolved();
 }
 
-inline void Board::calculateAdjacentMines() {
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::calculateAdjacentMines() {
     // Calculate adjacent mine count for each non-mine cell
     // 1. Loop through all cells
     // 2. For each non-mine cell, count adjacent mines using countAdjacentMines()
     // 3. Set the adjacent mine count using cell.setAdjacentMines()
+    // The grid is cut into bands of rows, computed in parallel on large boards.
+    // A band writes only its own rows, so it first copies the row just above and
+    // just below it (its halo rows); the copies are all taken before any band
+    // starts writing, as a neighbouring band owns those rows.
+    // Other topologies add each mine to its neighbours on this thread, which
+    // visits the neighbours of the mines only; neighbourhoods are symmetric.
+    // Counts a Cell cannot hold are added up in m_adjacent and stored saturated.
     const int n = getHeight();
-    const int m = getWidth();
-    for(int i = 0; i < n; ++i)
+    if constexpr (!Topology::LAYOUT_NEIGHBOURS or Topology::DEGREE != 8)
     {
-        for (int j = 0 ; j < m; ++j)
+        constexpr bool wide = Topology::DEGREE > MAX_STORED_ADJACENT;
+        if constexpr (wide)
+            m_adjacent.assign(m_cells.size(), 0);
+        for (int i = 0; i < n; ++i)
+        {
+            for (int j = 0; j < getWidth(); ++j)
+                m_cells[index(i, j)].setAdjacentMines(0);
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            for (int j = 0; j < getWidth(); ++j)
+            {
+                if (!m_cells[index(i, j)].isMine())
+                    continue;
+                forEachNeighbour(index(i, j), [&](int32_t next) {
+                    Cell& cell = m_cells[next];
+                    if constexpr (wide)
+                        m_adjacent[next] += 1;
+                    else if (!cell.isMine() and cell.getAdjacentMines() != SENTINEL_ADJACENT)
+                        cell.setAdjacentMines(cell.getAdjacentMines() + 1);
+                });
+            }
+        }
+        if constexpr (wide)
         {
-            if (!m_grid[i][j].isMine())
+            for (int i = 0; i < n; ++i)
             {
-                const int cnt = countAdjacentMines(i, j);
-                m_grid[i][j].setAdjacentMines(cnt);
+                for (int j = 0; j < getWidth(); ++j)
+                {
+                    Cell& cell = m_cells[index(i, j)];
+                    if (!cell.isMine())
+                        cell.setAdjacentMines(std::min<int>(m_adjacent[index(i, j)], MAX_STORED_ADJACENT));
+                }
             }
         }
+        return;
+    }
+    // Each band owns five rows of m_bandRows: its two halo rows, then the
+    // three rows countBand() rolls down the band
+    ThreadPool* pool = parallelPool();
+    const int bands = pool == nullptr or n < 2 ? 1 : std::min(n, pool->size() * 4);
+    const size_t stride = getWidth() + 2;
+    m_bandRows.resize(bands * 5 * stride);
+    auto rows = [&](int band) { return m_bandRows.data() + band * 5 * stride; };
+    auto bandStart = [&](int band) { return static_cast<int>(static_cast<long long>(n) * band / bands); };
+    if (bands == 1)
+    {
+        readMineRow(-1, rows(0));
+        readMineRow(n, rows(0) + stride);
+        countBand(0, n, rows(0));
+        return;
+    }
+    pool->parallelFor(bands, [&](int band) {
+        readMineRow(bandStart(band) - 1, rows(band));
+        readMineRow(bandStart(band + 1), rows(band) + stride);
+    });
+    pool->parallelFor(bands, [&](int band) {
+        countBand(bandStart(band), bandStart(band + 1), rows(band));
+    });
+}
+
+template <class Layout, class Topology>
+template <class Visit>
+inline void BasicBoard<Layout, Topology>::forEachNeighbour(int32_t c, Visit&& visit) const {
+    // The eight surrounding cells come from the layout, border cells included;
+    // other topologies name their neighbours by position, on the board only
+    if constexpr (Topology::LAYOUT_NEIGHBOURS)
+        m_layout.forEachNeighbour(c, visit);
+    else
+        m_topology.forEachNeighbour(rowOf(c), columnOf(c), m_width, m_height,
+                                    [&](int x, int y) { visit(index(x, y)); });
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::readMineRow(int x, uint8_t* out) const {
+    // Mine bits of row x, border columns included: out[j + 1] for column j
+    for (int j = -1; j <= getWidth(); ++j)
+    {
+        out[j + 1] = m_cells[index(x, j)].isMine() ? 1 : 0;
+    }
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::countBand(int x0, int x1, uint8_t* rows) {
+    // Adjacent counts of rows [x0, x1); rows holds five mine rows as laid out
+    // by readMineRow(): the rows just above and just below the band (halo
+    // copies), then room for three more
+    // Three mine rows roll down the band, so every cell is read once whatever
+    // the layout. Mines are summed per column over the three rows, and each
+    // count is the sum of three neighbouring column totals
+    const int m = getWidth();
+    const size_t stride = m + 2;
+    const uint8_t* below = rows + stride;
+    uint8_t* up = rows + 2 * stride;
+    uint8_t* row = rows + 3 * stride;
+    uint8_t* down = rows + 4 * stride;
+    std::copy(rows, rows + stride, up);
+    readMineRow(x0, row);
+    for (int i = x0; i < x1; ++i)
+    {
+        if (i + 1 == x1)
+            std::copy(below, below + stride, down);
+        else
+            readMineRow(i + 1, down);
+        int left = up[0] + row[0] + down[0];
+        int middle = up[1] + row[1] + down[1];
+        for (int j = 0; j < m; ++j)
+        {
+            const int right = up[j + 2] + row[j + 2] + down[j + 2];
+            if (!row[j + 1])
+                m_cells[index(i, j)].setAdjacentMines(left + middle + right);
+            left = middle;
+            middle = right;
+        }
+        uint8_t* spare = up;
+        up = row;
+        row = down;
+        down = spare;
     }
 }
 
-inline int Board::countAdjacentMines(int x, int y) const {
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::countAdjacentMines(int x, int y) const {
     // Count mines in adjacent cells
-    // 1. Get all adjacent positions using getAdjacentPositions()
+    // 1. Visit the neighbours through forEachNeighbour() (all of them valid positions)
     // 2. Count how many of those positions contain mines
     // 3. Return the count
-    vector<pair<int, int>> adj = Board::getAdjacentPositions(x, y);
     int cnt = 0;
-    for (auto cell: adj)
-    {
-        cnt += m_grid[cell.first][cell.second].isMine() ? 1: 0;
-    }
+    forEachNeighbour(index(x, y), [&](int32_t next) {
+        cnt += m_cells[next].isMine() ? 1 : 0;
+    });
     return cnt;
 }
 
-inline void Board::revealAdjacentCells(int x, int y) {
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getAdjacentMines(int x, int y) const {
+    // Exact adjacent count of the non-mine cell (x, y), once the mines are
+    // placed; getCell() holds it saturated on topologies of high DEGREE
+    if constexpr (Topology::DEGREE > MAX_STORED_ADJACENT)
+        return m_adjacent[index(x, y)];
+    else
+        return m_cells[index(x, y)].getAdjacentMines();
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::revealAdjacentCells(int x, int y) {
     // Reveal adjacent cells automatically (flood fill)
-    // 1. Use a queue-based approach for breadth-first search
-    // 2. Start with current position in queue
-    // 3. For each position in queue:
-    //    - Get adjacent positions
-    //    - For each adjacent cell that is not revealed, flagged, or a mine:
+    // 1. Open the precomputed region of (x, y) when nothing in it was touched yet
+    // 2. Otherwise use a queue-based approach for breadth-first search
+    // 3. Start with current position in queue and run the flood fill from it
+    if (openRegion(x, y))
+        return;
+    m_frontier.assign(1, index(x, y));
+    floodFill(m_frontier);
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::labelOpenings() {
+    // Label every connected region of zero cells (an opening) and list it
+    // together with its numbered border, so revealing a zero cell later is a
+    // walk over a precomputed list instead of a flood fill
+    // Each opening is walked breadth-first from its first cell rather than
+    // joined with union-find: the walk visits the neighbours of every zero cell
+    // once, never touches the numbered cells away from every opening, and needs
+    // no per-cell scratch. Cells the walk has reached carry the cell mark: zero
+    // cells until every opening is walked, numbered ones until their opening is.
+    // Every buffer is kept for the next layout; only the border list can grow.
+    // Topologies above DEGREE 8 list nothing and their reveals flood fill: with
+    // that many neighbours the walk costs about as much as the fills it saves.
+    if constexpr (Topology::DEGREE > 8)
+        return;
+    const int n = getHeight();
+    const int m = getWidth();
+    const size_t cells = m_cells.size();
+    auto isZero = [&](int32_t c) {
+        return !m_cells[c].isMine() and m_cells[c].getAdjacentMines() == 0;
+    };
+
+    // Bitmap of the zero cells, and the zero cells before each of its words
+    const size_t words = (cells + 63) / 64;
+    m_zeroMask.assign(words, 0);
+    m_zeroRank.assign(words, 0);
+    long long safe = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < m; ++j)
+        {
+            const int32_t c = index(i, j);
+            safe += m_cells[c].isMine() ? 0 : 1;
+            if (isZero(c))
+                m_zeroMask[c / 64] |= 1ULL << (c % 64);
+        }
+    }
+    int32_t zeros = 0;
+    for (size_t w = 0; w < words; ++w)
+    {
+        m_zeroRank[w] = zeros;
+        zeros += std::popcount(m_zeroMask[w]);
+    }
+
+    // Openings are numbered in row-major order of their first cell. Each
+    // opening's zero cells are listed in walk order, the list being the walk's
+    // queue, and its border as the walk finds it
+    m_openingStart.assign(1, 0);
+    m_openingCells.clear();
+    m_openingCells.reserve(zeros);
+    m_borderStart.assign(1, 0);
+    m_borderCells.clear();
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < m; ++j)
+        {
+            const int32_t first = index(i, j);
+            if (!isZero(first) or m_cells[first].isMarked())
+                continue;
+            m_cells[first].setMarked(true);
+            m_openingCells.push_back(first);
+            for (size_t head = m_openingStart.back(); head < m_openingCells.size(); ++head)
+            {
+                forEachNeighbour(m_openingCells[head], [&](int32_t next) {
+                    // Neighbours of a zero cell are never mines; skip the
+                    // sentinel border and the cells reached already
+                    Cell& cell = m_cells[next];
+                    if (cell.isMarked() or cell.getAdjacentMines() == SENTINEL_ADJACENT)
+                        return;
+                    cell.setMarked(true);
+                    if (cell.getAdjacentMines() == 0)
+                        m_openingCells.push_back(next);
+                    else
+                        m_borderCells.push_back(next);
+                });
+            }
+            for (size_t b = m_borderStart.back(); b < m_borderCells.size(); ++b)
+                m_cells[m_borderCells[b]].setMarked(false);
+            m_openingStart.push_back(static_cast<int32_t>(m_openingCells.size()));
+            m_borderStart.push_back(static_cast<int32_t>(m_borderCells.size()));
+        }
+    }
+
+    // Record the opening of every zero cell and clear its mark
+    m_zeroOpening.resize(zeros);
+    const int openings = static_cast<int>(m_openingStart.size()) - 1;
+    for (int k = 0; k < openings; ++k)
+    {
+        for (int32_t z = m_openingStart[k]; z < m_openingStart[k + 1]; ++z)
+        {
+            m_zeroOpening[zeroRank(m_openingCells[z])] = k;
+            m_cells[m_openingCells[z]].setMarked(false);
+        }
+    }
+
+    // Numbered cells that no opening lists are isolated numbers; the listed
+    // ones are counted once each by marking them
+    long long border = 0;
+    for (const int32_t c : m_borderCells)
+    {
+        border += m_cells[c].isMarked() ? 0 : 1;
+        m_cells[c].setMarked(true);
+    }
+    for (const int32_t c : m_borderCells)
+        m_cells[c].setMarked(false);
+    m_isolatedCount = static_cast<int>(safe - zeros - border);
+}
+
+template <class Layout, class Topology>
+inline int32_t BasicBoard<Layout, Topology>::openingOf(int32_t c) const {
+    // Opening of the zero cell c, -1 for any other cell; valid once labelled
+    if (!(m_zeroMask[c / 64] & (1ULL << (c % 64))))
+        return -1;
+    return m_zeroOpening[zeroRank(c)];
+}
+
+template <class Layout, class Topology>
+inline int32_t BasicBoard<Layout, Topology>::zeroRank(int32_t c) const {
+    // Position of the zero cell c in m_zeroOpening: its rank among the zero
+    // cells, the word's rank plus the zero cells before it in the word
+    const uint64_t word = m_zeroMask[c / 64];
+    return m_zeroRank[c / 64] + std::popcount(word & ((1ULL << (c % 64)) - 1));
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getOpeningCount() const {
+    // Number of openings (connected zero regions), known once the mines are
+    // placed; 0 on topologies that list none, see labelOpenings()
+    return static_cast<int>(m_openingStart.empty() ? 0 : m_openingStart.size() - 1);
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getIsolatedNumberCount() const {
+    // Numbered cells bordering no opening, known once the mines are placed
+    return m_isolatedCount;
+}
+
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::openRegion(int x, int y) {
+    // Reveal the precomputed opening of the zero cell (x, y)
+    // Only valid while the opening is untouched: no flags in it and no zero cell
+    // revealed besides (x, y), otherwise the flood fill would stop at flags and
+    // at revealed cells. Returns false when the caller has to fall back to it.
+    const int32_t self = index(x, y);
+    const int32_t opening = m_openingStart.empty() ? -1 : openingOf(self);
+    if (opening < 0)
+        return false;
+    // The opening's cells: its zero cells, then its border
+    const int32_t* zeroCells = m_openingCells.data() + m_openingStart[opening];
+    const int32_t* borderCells = m_borderCells.data() + m_borderStart[opening];
+    const ptrdiff_t zeroCount = m_openingStart[opening + 1] - m_openingStart[opening];
+    const ptrdiff_t size = zeroCount + m_borderStart[opening + 1] - m_borderStart[opening];
+    auto cellAt = [&](ptrdiff_t k) { return k < zeroCount ? zeroCells[k] : borderCells[k - zeroCount]; };
+    for (ptrdiff_t k = 0; k < size; ++k)
+    {
+        const int32_t c = cellAt(k);
+        const Cell& cell = m_cells[c];
+        if (cell.isFlagged() or (c != self and cell.isRevealed() and cell.getAdjacentMines() == 0))
+            return false;
+    }
+    int revealed = 0;
+    ThreadPool* pool = parallelPool();
+    if (pool != nullptr and size >= PARALLEL_MIN_CELLS / 16)
+    {
+        // Cells of one opening are distinct, so chunks of the list can be revealed
+        // concurrently; the reveals are reported afterwards on this thread
+        const int tasks = pool->size() * 4;
+        const ptrdiff_t chunk = (size + tasks - 1) / tasks;
+        vector<vector<int32_t>>& opened = m_taskCells;
+        opened.resize(tasks);
+        pool->parallelFor(tasks, [&](int task) {
+            opened[task].clear();
+            const ptrdiff_t to = std::min<ptrdiff_t>(size, (task + 1) * chunk);
+            for (ptrdiff_t k = std::min<ptrdiff_t>(size, task * chunk); k < to; ++k)
+            {
+                Cell& cell = m_cells[cellAt(k)];
+                if (cell.isRevealed())
+                    continue;
+                cell.reveal();
+                opened[task].push_back(cellAt(k));
+            }
+            resolveConcurrently(opened[task]);
+        });
+        for (const vector<int32_t>& list : opened)
+            revealed += static_cast<int>(list.size());
+        m_revealedCount += revealed;
+        noteRevealedCells(opened);
+        Metrics::add(Metrics::FLOOD_FILL_CELLS, revealed);
+        return true;
+    }
+    for (ptrdiff_t k = 0; k < size; ++k)
+    {
+        const int32_t c = cellAt(k);
+        Cell& cell = m_cells[c];
+        if (cell.isRevealed())
+            continue;
+        cell.reveal();
+        m_revealedCount += 1;
+        noteReveal(rowOf(c), columnOf(c), false);
+        revealed += 1;
+    }
+    Metrics::add(Metrics::FLOOD_FILL_CELLS, revealed);
+    return true;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::floodFill(vector<int32_t>& frontier) {
+    // Breadth-first opening from every zero cell already in the frontier
+    // The frontier is used as a queue: cells are taken in order and new ones appended.
+    // For each cell taken:
+    //    - Visit its neighbours through forEachNeighbour()
+    //    - For each neighbour that is hidden (not revealed, not flagged, never
+    //      true for the border) and not a mine:
     //      * Reveal the cell
     //      * Increment m_revealedCount
-    //      * If cell has no adjacent mines, add to queue
-    queue<pair<int, int>> Q;
-    Q.push({x, y});
-    while(!Q.empty())
-    {
-        pair<int, int> cur = Q.front();
-        Q.pop();
-        vector<pair<int, int>> nbr = this->getAdjacentPositions(cur.first, cur.second);
-        
-        for (auto cell: nbr)
+    //      * If cell has no adjacent mines, append it
+    // Several seeds give one multi-source fill
+    // Newly revealed cells are tallied locally and published to the metrics once
+    // On large boards a fill that outgrows a serial prefix and has a wide
+    // frontier is handed to parallelFloodFill(), which reveals the same cells and
+    // hands back what is left once the frontier narrows; most openings end
+    // within the prefix and never pay for the pool
+    ThreadPool* pool = frontier.empty() ? nullptr : parallelPool();
+    int revealed = 0;
+    size_t serial = 0;
+    for (size_t head = 0; head < frontier.size(); ++head, ++serial)
+    {
+        if (pool != nullptr and serial >= PARALLEL_FILL_PREFIX and frontier.size() - head >= PARALLEL_MIN_FRONTIER)
         {
-            int r = cell.first, c = cell.second;
-            if (!this->m_grid[r][c].isMine() and 
-                !this->m_grid[r][c].isRevealed() and 
-                !this->m_grid[r][c].isFlagged())
+            frontier.erase(frontier.begin(), frontier.begin() + head);
+            parallelFloodFill(frontier);
+            head = 0;
+            serial = 0;
+            if (frontier.empty())
+                break;
+        }
+        forEachNeighbour(frontier[head], [&](int32_t next) {
+            Cell& cell = m_cells[next];
+            if (cell.isMine() or cell.getState() != Cell::HIDDEN)
+                return;
+            cell.reveal();
+            m_revealedCount += 1;
+            noteReveal(rowOf(next), columnOf(next), false);
+            revealed += 1;
+            if (cell.getAdjacentMines() == 0)
+                frontier.push_back(next);
+        });
+    }
+    Metrics::add(Metrics::FLOOD_FILL_CELLS, revealed);
+}
+
+template <class Layout, class Topology>
+inline ThreadPool* BasicBoard<Layout, Topology>::parallelPool() const {
+    // The pool to run on, or nullptr when the board is too small to benefit or
+    // runs serially
+    if (!m_parallel or static_cast<long long>(m_width) * m_height < PARALLEL_MIN_CELLS)
+        return nullptr;
+    ThreadPool* pool = m_pool ? m_pool : &ThreadPool::shared();
+    return pool->size() > 1 ? pool : nullptr;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::setThreadPool(ThreadPool* pool) {
+    // Pool used for the parallel paths of large boards; nullptr selects ThreadPool::shared()
+    m_pool = pool;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::setParallel(bool parallel) {
+    // false keeps every path of this board on the calling thread whatever its
+    // size, e.g. for boards that are themselves built inside pool tasks
+    m_parallel = parallel;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::parallelFloodFill(vector<int32_t>& frontier) {
+    // Level-synchronous version of floodFill() for the cells in frontier
+    // Each level runs in two parallel phases separated by the pool's barrier:
+    // 1. Scan the neighbours of the frontier; a hidden, unflagged non-mine cell
+    //    is taken by the one task that wins its byte in m_claimed. Cells are
+    //    only read in this phase.
+    // 2. Every task reveals the cells it claimed and moves the zero cells to the
+    //    front of its list; those form the next frontier.
+    // A cell is opened iff a path of zero cells leads to it from a seed, exactly
+    // as in the breadth-first fill, so the revealed set and counts are identical.
+    // Returns when a level is narrower than PARALLEL_MIN_FRONTIER, with the zero
+    // cells still to expand left in frontier for floodFill() to finish
+    ThreadPool& pool = *parallelPool();
+    if (m_claimed.size() != m_cells.size())
+        m_claimed.assign(m_cells.size(), 0);
+    const int tasks = pool.size() * 4;
+    vector<vector<int32_t>>& claimed = m_taskCells;
+    vector<size_t>& zeros = m_taskZeros;
+    claimed.resize(tasks);
+    zeros.resize(tasks);
+    vector<vector<int32_t>> opened;
+    const bool notify = m_minimap or m_delta or m_revealIndex;
+    int revealed = 0;
+
+    while (frontier.size() >= PARALLEL_MIN_FRONTIER)
+    {
+        const size_t chunk = (frontier.size() + tasks - 1) / tasks;
+        pool.parallelFor(tasks, [&](int task) {
+            vector<int32_t>& local = claimed[task];
+            local.clear();
+            const size_t from = std::min(frontier.size(), task * chunk);
+            const size_t to = std::min(frontier.size(), from + chunk);
+            for (size_t k = from; k < to; ++k)
             {
-                this->m_grid[r][c].reveal();
-                this->m_revealedCount += 1;
-                if( Board::countAdjacentMines(cell.first, cell.second) == 0 ) Q.push(cell);
+                forEachNeighbour(frontier[k], [&](int32_t c) {
+                    const Cell& cell = m_cells[c];
+                    if (cell.isMine() or cell.getState() != Cell::HIDDEN)
+                        return;
+                    if (std::atomic_ref<uint8_t>(m_claimed[c]).exchange(1, std::memory_order_relaxed) == 0)
+                        local.push_back(c);
+                });
             }
+        });
+        pool.parallelFor(tasks, [&](int task) {
+            vector<int32_t>& local = claimed[task];
+            for (const int32_t c : local)
+                m_cells[c].reveal();
+            resolveConcurrently(local);
+            auto isZero = [&](int32_t c) { return m_cells[c].getAdjacentMines() == 0; };
+            zeros[task] = std::stable_partition(local.begin(), local.end(), isZero) - local.begin();
+        });
+
+        frontier.clear();
+        for (int task = 0; task < tasks; ++task)
+        {
+            revealed += static_cast<int>(claimed[task].size());
+            frontier.insert(frontier.end(), claimed[task].begin(), claimed[task].begin() + zeros[task]);
+            if (notify and !claimed[task].empty())
+                opened.push_back(claimed[task]);
         }
     }
+    m_revealedCount += revealed;
+    noteRevealedCells(opened);
+    Metrics::add(Metrics::FLOOD_FILL_CELLS, revealed);
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::noteRevealedCells(const vector<vector<int32_t>>& lists) {
+    // Report cells revealed by a parallel phase; the consumers are single threaded
+    // The unresolved counts were already taken off by the tasks themselves
+    if (!m_minimap and !m_delta and !m_revealIndex)
+        return;
+    for (const vector<int32_t>& list : lists)
+    {
+        for (const int32_t c : list)
+            notifyReveal(rowOf(c), columnOf(c), false);
+    }
+}
+
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::chordCell(int x, int y, int& minesHit) {
+    // Chord on a revealed number: when its flagged neighbours match the number,
+    // open every other hidden neighbour in one batch
+    // 1. The cell must be a revealed, non-mine number
+    // 2. Count flagged neighbours; they must equal the adjacent mine count
+    // 3. Reveal every hidden, unflagged neighbour and count the mines among them
+    // 4. Zero neighbours become seeds of a single multi-source flood fill
+    // Returns false when the chord does not apply or opens nothing
+    minesHit = 0;
+    if (!isValidPosition(x, y))
+        return false;
+    const Cell& center = m_cells[index(x, y)];
+    if (!center.isRevealed() or center.isMine() or center.getAdjacentMines() == 0)
+        return false;
+
+    const int32_t c = index(x, y);
+    int flagged = 0;
+    forEachNeighbour(c, [&](int32_t next) {
+        flagged += m_cells[next].isFlagged() ? 1 : 0;
+    });
+    if (flagged != getAdjacentMines(x, y))
+        return false;
+
+    m_frontier.clear();
+    int opened = 0;
+    forEachNeighbour(c, [&](int32_t next) {
+        opened += openCell(next, m_frontier, minesHit) ? 1 : 0;
+    });
+    floodFill(m_frontier);
+    return opened > 0;
 }
 
-inline std::vector<std::pair<int, int>> Board::getAdjacentPositions(int x, int y) const {
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::openCell(int32_t c, vector<int32_t>& frontier, int& minesHit) {
+    // Reveal one hidden, unflagged cell as part of a batch
+    // Mines are counted in minesHit, zero cells are queued as flood fill seeds
+    Cell& cell = m_cells[c];
+    if (cell.isRevealed() or cell.isFlagged())
+        return false;
+    cell.reveal();
+    m_revealedCount += 1;
+    noteReveal(rowOf(c), columnOf(c), cell.isMine());
+    if (cell.isMine())
+        minesHit += 1;
+    else if (cell.getAdjacentMines() == 0)
+        frontier.push_back(c);
+    return true;
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::revealCells(std::span<const std::pair<int, int>> cells, int& minesHit) {
+    // Reveal every listed cell, then open all their zero regions in one flood fill
+    // Invalid, revealed and flagged cells are skipped
+    // On a fresh board the first valid, unflagged cell is the protected first click
+    // Returns the number of cells revealed, flood fill included
+    minesHit = 0;
+    const int before = m_revealedCount;
+    m_frontier.clear();
+    for (const auto& cell : cells)
+    {
+        if (!isValidPosition(cell.first, cell.second))
+            continue;
+        if (!m_initialized and !m_cells[index(cell.first, cell.second)].isFlagged())
+        {
+            initializeMines(cell.first, cell.second);
+            m_initialized = true;
+        }
+        openCell(index(cell.first, cell.second), m_frontier, minesHit);
+    }
+    floodFill(m_frontier);
+    return m_revealedCount - before;
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::revealRect(int x0, int y0, int x1, int y1, int& minesHit) {
+    // Same as revealCells() for every cell of the rectangle with corners
+    // (x0, y0) and (x1, y1), both inclusive, clipped to the board
+    minesHit = 0;
+    const int top = std::max(0, std::min(x0, x1));
+    const int left = std::max(0, std::min(y0, y1));
+    const int bottom = std::min(getHeight() - 1, std::max(x0, x1));
+    const int right = std::min(getWidth() - 1, std::max(y0, y1));
+    const int before = m_revealedCount;
+    m_frontier.clear();
+    for (int i = top; i <= bottom; ++i)
+    {
+        for (int j = left; j <= right; ++j)
+        {
+            if (!m_initialized and !m_cells[index(i, j)].isFlagged())
+            {
+                initializeMines(i, j);
+                m_initialized = true;
+            }
+            openCell(index(i, j), m_frontier, minesHit);
+        }
+    }
+    floodFill(m_frontier);
+    return m_revealedCount - before;
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::flagCells(std::span<const std::pair<int, int>> cells) {
+    // Flag every listed hidden cell; flags are set, never toggled off
+    // Returns the number of cells newly flagged
+    int flagged = 0;
+    for (const auto& cell : cells)
+    {
+        if (isValidPosition(cell.first, cell.second) and m_cells[index(cell.first, cell.second)].getState() == Cell::HIDDEN)
+        {
+            toggleFlag(cell.first, cell.second);
+            flagged += 1;
+        }
+    }
+    return flagged;
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::flagRect(int x0, int y0, int x1, int y1) {
+    // Same as flagCells() for the inclusive rectangle (x0, y0)-(x1, y1)
+    int flagged = 0;
+    const int top = std::max(0, std::min(x0, x1));
+    const int left = std::max(0, std::min(y0, y1));
+    const int bottom = std::min(getHeight() - 1, std::max(x0, x1));
+    const int right = std::min(getWidth() - 1, std::max(y0, y1));
+    for (int i = top; i <= bottom; ++i)
+    {
+        for (int j = left; j <= right; ++j)
+        {
+            if (m_cells[index(i, j)].getState() == Cell::HIDDEN)
+            {
+                toggleFlag(i, j);
+                flagged += 1;
+            }
+        }
+    }
+    return flagged;
+}
+
+template <class Layout, class Topology>
+inline std::vector<std::pair<int, int>> BasicBoard<Layout, Topology>::getAdjacentPositions(int x, int y) const {
     // Get all valid adjacent positions
-    // 1. Check all 8 directions around (x, y)
-    // 2. Only include positions that are within board bounds
+    // 1. Ask the topology for the neighbours of (x, y), in its table order
+    // 2. It only yields positions that are within board bounds
     // 3. Return vector of valid (x, y) pairs
-    vector<int> dx = {-1, -1, 0, 1, 1, 1, 0, -1};
-    vector<int> dy = {0, 1, 1, 1, 0, -1, -1, -1};
     vector<pair<int, int>> res;
-    for (int dir = 0; dir < 8; ++dir)
+    res.reserve(Topology::DEGREE);
+    m_topology.forEachNeighbour(x, y, m_width, m_height, [&](int _x, int _y) {
+        res.push_back({_x, _y});
+    });
+    return res;
+}
+
+template <class Layout, class Topology>
+inline typename BasicBoard<Layout, Topology>::MemoryUsage BasicBoard<Layout, Topology>::memoryUsage() const {
+    // Report the bytes owned by this board
+    // Capacities are used rather than sizes since that is what the allocator handed out
+    MemoryUsage usage{};
+    usage.object = sizeof(BasicBoard);
+    usage.rng = sizeof(m_rng);
+    usage.rows = (m_unresolvedRows.capacity() + m_unresolvedTiles.capacity()) * sizeof(int32_t);
+    if (m_revealIndex)
+        usage.rows += sizeof(RevealIndex) + m_revealIndex->memoryUsage();
+    usage.grid = m_cells.capacity() * sizeof(Cell) + m_adjacent.capacity() * sizeof(WideCount);
+    usage.scratch = m_zeroMask.capacity() * sizeof(uint64_t);
+    usage.scratch += (m_zeroRank.capacity() + m_zeroOpening.capacity() + m_openingStart.capacity() +
+                      m_openingCells.capacity() + m_borderStart.capacity() + m_borderCells.capacity()) *
+                     sizeof(int32_t);
+    usage.scratch += m_claimed.capacity() + m_bandRows.capacity() + m_frontier.capacity() * sizeof(int32_t) +
+                     m_taskZeros.capacity() * sizeof(size_t);
+    for (const vector<int32_t>& list : m_taskCells)
+        usage.scratch += list.capacity() * sizeof(int32_t);
+    if (m_minimap)
     {
-        int _x = x+dx[dir], _y = y+dy[dir];
-        if(isValidPosition(_x, _y))
+        usage.scratch += sizeof(Minimap) + static_cast<size_t>(m_minimap->getTileRows()) *
+                         m_minimap->getTileCols() * sizeof(Minimap::Tile);
+    }
+    return usage;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::enableMinimap(int tileSize) {
+    // Build the minimap from the current cells once; afterwards every reveal and
+    // flag updates it incrementally
+    m_minimap = std::make_unique<Minimap>(m_width, m_height, tileSize);
+    for (int i = 0; i < m_height; ++i)
+    {
+        for (int j = 0; j < m_width; ++j)
         {
-            res.push_back({_x, _y});
+            const Cell& cell = m_cells[index(i, j)];
+            if (cell.isRevealed())
+                m_minimap->onReveal(i, j, cell.isMine());
+            else if (cell.isFlagged())
+                m_minimap->onFlag(i, j, true);
         }
     }
-    return res;
+}
+
+template <class Layout, class Topology>
+inline const Minimap* BasicBoard<Layout, Topology>::getMinimap() const {
+    // Return the minimap, or nullptr when it was never enabled
+    return m_minimap.get();
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::enableRevealIndex() {
+    // Build the run index of revealed cells from the current cells once; it is
+    // kept current by every reveal and flag from then on. Rendering and
+    // readRegion() use it to skip hidden spans, which pays off on huge boards.
+    m_revealIndex = std::make_unique<RevealIndex>(m_height);
+    for (int i = 0; i < m_height; ++i)
+    {
+        for (int j = 0; j < m_width; ++j)
+        {
+            const Cell& cell = m_cells[index(i, j)];
+            if (cell.isRevealed())
+                m_revealIndex->onReveal(i, j);
+            else if (cell.isFlagged())
+                m_revealIndex->onFlag(i, j, true);
+        }
+    }
+}
+
+template <class Layout, class Topology>
+inline const RevealIndex* BasicBoard<Layout, Topology>::getRevealIndex() const {
+    // Return the reveal index, or nullptr when it was never enabled
+    return m_revealIndex.get();
+}
+
+template <class Layout, class Topology>
+template <class Hidden, class Revealed>
+inline void BasicBoard<Layout, Topology>::forEachSpan(int x, int y0, int y1, Hidden&& hidden, Revealed&& revealed) const {
+    // Split columns [y0, y1) of row x into maximal spans of unrevealed and of
+    // revealed cells, from left to right, with the reveal index
+    const std::span<const RevealIndex::Run> runs = m_revealIndex->getRuns(x);
+    auto run = std::partition_point(runs.begin(), runs.end(), [&](const RevealIndex::Run& r) { return r.end <= y0; });
+    int j = y0;
+    for (; run != runs.end() and run->begin < y1; ++run)
+    {
+        if (j < run->begin)
+            hidden(j, run->begin);
+        const int from = std::max(run->begin, y0);
+        j = std::min(run->end, y1);
+        revealed(from, j);
+    }
+    if (j < y1)
+        hidden(j, y1);
+}
+
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::readRegion(int x0, int y0, int rows, int cols, std::span<uint8_t> out) const requires (Topology::DEGREE <= 8) {
+    // Copy the visible state of the rows x cols rectangle at (x0, y0) into out,
+    // row-major, one Cell::visibleCode() per cell (0-8, hidden, flag, mine)
+    // Returns false when the rectangle leaves the board or out is too small
+    if (rows < 0 or cols < 0 or x0 < 0 or y0 < 0 or x0 + rows > getHeight() or y0 + cols > getWidth())
+        return false;
+    if (out.size() < static_cast<size_t>(rows) * cols)
+        return false;
+    uint8_t* cursor = out.data();
+    for (int i = x0; i < x0 + rows; ++i)
+    {
+        if (m_revealIndex and m_revealIndex->getFlagCount(i) == 0)
+        {
+            // Without flags in the row every unrevealed span reads as hidden
+            forEachSpan(i, y0, y0 + cols,
+                        [&](int from, int to) { std::fill(cursor + (from - y0), cursor + (to - y0), Cell::CODE_HIDDEN); },
+                        [&](int from, int to) {
+                            for (int j = from; j < to; ++j)
+                                cursor[j - y0] = Cell::visibleCode(m_cells[index(i, j)].getPacked());
+                        });
+            cursor += cols;
+            continue;
+        }
+        for (int j = 0; j < cols; ++j)
+        {
+            cursor[j] = Cell::visibleCode(m_cells[index(i, y0 + j)].getPacked());
+        }
+        cursor += cols;
+    }
+    return true;
+}
+
+template <class Layout, class Topology>
+inline std::span<const Cell> BasicBoard<Layout, Topology>::rowView(int x) const requires Layout::CONTIGUOUS_ROWS {
+    // Read-only view of one row; cells are single packed bytes stored contiguously
+    // Note that getPacked() includes the mine bit of hidden cells, so untrusted
+    // clients should go through Cell::visibleCode() or readRegion()
+    return std::span<const Cell>(m_cells.data() + index(x, 0), m_width);
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::setDelta(BoardDelta* delta) {
+    // Attach a caller owned buffer that receives every cell whose visible state
+    // changes from now on; nullptr detaches it
+    m_delta = delta;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::loadMines(std::span<const std::pair<int, int>> mines) {
+    // Take a mine layout produced elsewhere (e.g. the BitBoard8 engine) instead
+    // of placeMines(); the board counts as initialized afterwards
+    for (const auto& mine : mines)
+    {
+        if (!isValidPosition(mine.first, mine.second))
+            continue;
+        Cell& cell = m_cells[index(mine.first, mine.second)];
+        if (!cell.isMine() and !cell.isRevealed())
+        {
+            m_unresolvedRows[mine.first] -= 1;
+            m_unresolvedTiles[unresolvedTile(mine.first, mine.second)] -= 1;
+        }
+        cell.setMine(true);
+    }
+    calculateAdjacentMines();
+    labelOpenings();
+    m_initialized = true;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::syncCell(int x, int y, Cell::State state) {
+    // Mirror a state change made by another engine onto this cell
+    // Counters, minimap and delta are updated as if the change happened here
+    Cell& cell = m_cells[index(x, y)];
+    if (cell.getState() == state or cell.isRevealed())
+        return;
+    if (state == Cell::REVEALED)
+    {
+        if (cell.isFlagged())
+        {
+            cell.toggleFlag();
+            m_flagCount -= 1;
+            noteFlag(x, y, false);
+        }
+        cell.reveal();
+        m_revealedCount += 1;
+        noteReveal(x, y, cell.isMine());
+        return;
+    }
+    cell.toggleFlag();
+    m_flagCount += cell.isFlagged() ? 1 : -1;
+    noteFlag(x, y, cell.isFlagged());
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::noteReveal(int x, int y, bool mine) {
+    // Single place every reveal is reported to the incremental consumers
+    if (mine)
+    {
+        m_revealedMineCount += 1;
+    }
+    else
+    {
+        m_unresolvedRows[x] -= 1;
+        m_unresolvedTiles[unresolvedTile(x, y)] -= 1;
+    }
+    notifyReveal(x, y, mine);
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::notifyReveal(int x, int y, bool mine) {
+    if (m_minimap)
+        m_minimap->onReveal(x, y, mine);
+    if (m_revealIndex)
+        m_revealIndex->onReveal(x, y);
+    if (m_delta)
+        m_delta->add(x, y);
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::noteFlag(int x, int y, bool flagged) {
+    if (m_minimap)
+        m_minimap->onFlag(x, y, flagged);
+    if (m_revealIndex)
+        m_revealIndex->onFlag(x, y, flagged);
+    if (m_delta)
+        m_delta->add(x, y);
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::unresolvedTile(int x, int y) const {
+    const int tileCols = (m_width + UNRESOLVED_TILE - 1) / UNRESOLVED_TILE;
+    return (x / UNRESOLVED_TILE) * tileCols + y / UNRESOLVED_TILE;
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::countUnresolved() {
+    // Recount the unresolved cells from the grid, for a new or reset board
+    // Placing mines and revealing cells keep the counts up to date afterwards
+    const int tileRows = (m_height + UNRESOLVED_TILE - 1) / UNRESOLVED_TILE;
+    const int tileCols = (m_width + UNRESOLVED_TILE - 1) / UNRESOLVED_TILE;
+    m_unresolvedRows.assign(m_height, 0);
+    m_unresolvedTiles.assign(static_cast<size_t>(tileRows) * tileCols, 0);
+    for (int i = 0; i < m_height; ++i)
+    {
+        int32_t* tiles = m_unresolvedTiles.data() + static_cast<size_t>(i / UNRESOLVED_TILE) * tileCols;
+        for (int j = 0; j < m_width; ++j)
+        {
+            const Cell& cell = m_cells[index(i, j)];
+            if (cell.isRevealed() or cell.isMine())
+                continue;
+            m_unresolvedRows[i] += 1;
+            tiles[j / UNRESOLVED_TILE] += 1;
+        }
+    }
+}
+
+template <class Layout, class Topology>
+inline void BasicBoard<Layout, Topology>::resolveConcurrently(std::span<const int32_t> cells) {
+    // Take the non-mine cells one task of a parallel phase revealed off the
+    // unresolved counts; tasks share rows and tiles, so the updates are atomic
+    for (const int32_t c : cells)
+    {
+        const int x = rowOf(c), y = columnOf(c);
+        std::atomic_ref<int32_t>(m_unresolvedRows[x]).fetch_sub(1, std::memory_order_relaxed);
+        std::atomic_ref<int32_t>(m_unresolvedTiles[unresolvedTile(x, y)]).fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getUnresolvedInRow(int x) const {
+    // Hidden or flagged non-mine cells left in row x; before the mines are
+    // placed every cell counts
+    return m_unresolvedRows[x];
+}
+
+template <class Layout, class Topology>
+inline int BasicBoard<Layout, Topology>::getUnresolvedInTile(int tileRow, int tileCol) const {
+    // Same for the tile of rows [tileRow, tileRow + 1) * UNRESOLVED_TILE and the
+    // matching columns
+    const int tileCols = (m_width + UNRESOLVED_TILE - 1) / UNRESOLVED_TILE;
+    return m_unresolvedTiles[static_cast<size_t>(tileRow) * tileCols + tileCol];
+}
+
+template <class Layout, class Topology>
+inline bool BasicBoard<Layout, Topology>::nextUnresolved(int& x, int& y) const {
+    // Move (x, y) to the first unresolved cell at or after it in row-major order
+    // Rows whose count is zero are skipped without reading a cell, and so are the
+    // stretches of a row that lie in a finished tile; late in a game on a big
+    // board nearly the whole scan is such skips. Returns false when none is left.
+    int from = std::max(0, y);
+    for (int i = std::max(0, x); i < m_height; ++i, from = 0)
+    {
+        if (m_unresolvedRows[i] == 0)
+            continue;
+        for (int j = from; j < m_width;)
+        {
+            if (m_unresolvedTiles[unresolvedTile(i, j)] == 0)
+            {
+                j = (j / UNRESOLVED_TILE + 1) * UNRESOLVED_TILE;
+                continue;
+            }
+            const Cell& cell = m_cells[index(i, j)];
+            if (!cell.isRevealed() and !cell.isMine())
+            {
+                x = i;
+                y = j;
+                return true;
+            }
+            ++j;
+        }
+    }
+    return false;
 }
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// Cells whose visible state changed during a board mutation.
+// The buffer is owned by the caller and reused between moves, so recording a
+// change is an append into already reserved storage.
+class BoardDelta {
+public:
+    struct CellChange {
+        int x;
+        int y;
+    };
+
+    void clear();
+    void reserve(size_t capacity);
+    void add(int x, int y);
+
+    size_t size() const;
+    bool empty() const;
+    const CellChange& operator[](size_t index) const;
+    vector<CellChange>::const_iterator begin() const;
+    vector<CellChange>::const_iterator end() const;
+
+private:
+    vector<CellChange> m_changes;
+};
+
+inline void BoardDelta::clear() {
+    // Keeps the capacity for the next move
+    m_changes.clear();
+}
+
+inline void BoardDelta::reserve(size_t capacity) {
+    m_changes.reserve(capacity);
+}
+
+inline void BoardDelta::add(int x, int y) {
+    m_changes.push_back({x, y});
+}
+
+inline size_t BoardDelta::size() const {
+    return m_changes.size();
+}
+
+inline bool BoardDelta::empty() const {
+    return m_changes.empty();
+}
+
+inline const BoardDelta::CellChange& BoardDelta::operator[](size_t index) const {
+    return m_changes[index];
+}
+
+inline vector<BoardDelta::CellChange>::const_iterator BoardDelta::begin() const {
+    return m_changes.begin();
+}
+
+inline vector<BoardDelta::CellChange>::const_iterator BoardDelta::end() const {
+    return m_changes.end();
+}
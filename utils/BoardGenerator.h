@@ -0,0 +1,85 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Board.h"
+#include "BoardStats.h"
+#include "ThreadPool.h"
+#include "SplitMix64.h"
+using namespace std;
+
+// Boards with a difficulty inside a requested band.
+// Candidate layouts are drawn by every thread of a pool at once, each thread on
+// its own seeded generator stream, and scored from the opening labels the
+// board computes with its mines (see BoardStats). The first candidate inside the band wins and
+// the other threads stop at their next check.
+class BoardGenerator {
+public:
+    enum Metric
+    {
+        BBBV,
+        OPENINGS
+    };
+
+    struct Target {
+        Metric metric;
+        int minValue;  // inclusive
+        int maxValue;  // inclusive
+    };
+
+    // Generate a width x height layout with the given mines in which
+    // (safeX, safeY) is mine-free, or return nullptr when maxCandidates
+    // layouts were tried without a match
+    static std::unique_ptr<Board> generate(int width, int height, int mines, int safeX, int safeY,
+                                           const Target& target, uint64_t seed, long maxCandidates = 1000000,
+                                           ThreadPool& pool = ThreadPool::shared());
+};
+
+inline std::unique_ptr<Board> BoardGenerator::generate(int width, int height, int mines, int safeX, int safeY,
+                                                       const Target& target, uint64_t seed, long maxCandidates,
+                                                       ThreadPool& pool) {
+    if (width <= 0 || height <= 0 || safeX < 0 || safeX >= height || safeY < 0 || safeY >= width ||
+        mines < 0 || mines >= width * height) {
+        return nullptr;
+    }
+
+    std::atomic<long> tried{0};
+    std::atomic<bool> found{false};
+    std::mutex resultMutex;
+    std::vector<std::pair<int, int>> layout;
+
+    pool.parallelFor(pool.size(), [&](int worker) {
+        // Candidates already run one per thread, so each stays on its own thread
+        // even when large enough for the parallel paths
+        Board candidate(width, height, mines, SplitMix64::stream(seed, worker));
+        candidate.setParallel(false);
+        while (!found.load(std::memory_order_relaxed) &&
+               tried.fetch_add(1, std::memory_order_relaxed) < maxCandidates) {
+            candidate.reset();
+            candidate.initializeMines(safeX, safeY);
+            const int value = target.metric == OPENINGS ? candidate.getOpeningCount()
+                                                        : BoardStats::compute(candidate).bbbv;
+            if (value < target.minValue || value > target.maxValue) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(resultMutex);
+            if (found.exchange(true)) {
+                return;
+            }
+            for (int i = 0; i < height; ++i) {
+                for (int j = 0; j < width; ++j) {
+                    if (candidate.isMineAt(i, j)) {
+                        layout.push_back({i, j});
+                    }
+                }
+            }
+            return;
+        }
+    });
+
+    if (!found.load()) {
+        return nullptr;
+    }
+    auto board = std::make_unique<Board>(width, height, mines);
+    board->loadMines(layout);
+    return board;
+}
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// Storage layouts for BasicBoard.
+// A layout maps board positions to indices into one cell array and visits the
+// neighbours of an index. Positions include the one-cell sentinel border
+// (x in [-1, height], y in [-1, width]), so a neighbour is always a valid index.
+// Required members:
+//   Layout(int width, int height)          or any constructor, for boards given the layout
+//   size_t size() const                    cells to allocate
+//   int32_t index(int x, int y) const
+//   int row(int32_t c) const, int column(int32_t c) const
+//   void forEachNeighbour(int32_t c, F&& visit) const
+//   static constexpr bool CONTIGUOUS_ROWS  whether a row is one run of cells
+//   static constexpr int NEIGHBOURS        neighbours forEachNeighbour() visits
+
+// Row after row; neighbours are eight fixed offsets
+class RowMajorLayout {
+public:
+    static constexpr bool CONTIGUOUS_ROWS = true;
+    static constexpr int NEIGHBOURS = 8;
+
+    RowMajorLayout(int width, int height);
+
+    size_t size() const;
+    int32_t index(int x, int y) const;
+    int row(int32_t c) const;
+    int column(int32_t c) const;
+
+    template <class Visit>
+    void forEachNeighbour(int32_t c, Visit&& visit) const;
+
+private:
+    int m_stride;
+    size_t m_size;
+    int m_offsets[8];
+};
+
+inline RowMajorLayout::RowMajorLayout(int width, int height)
+    : m_stride(width + 2)
+    , m_size(static_cast<size_t>(height + 2) * (width + 2))
+    , m_offsets{-width - 3, -width - 2, -width - 1, -1, 1, width + 1, width + 2, width + 3}
+{
+}
+
+inline size_t RowMajorLayout::size() const {
+    return m_size;
+}
+
+inline int32_t RowMajorLayout::index(int x, int y) const {
+    return (x + 1) * m_stride + (y + 1);
+}
+
+inline int RowMajorLayout::row(int32_t c) const {
+    return c / m_stride - 1;
+}
+
+inline int RowMajorLayout::column(int32_t c) const {
+    return c % m_stride - 1;
+}
+
+template <class Visit>
+inline void RowMajorLayout::forEachNeighbour(int32_t c, Visit&& visit) const {
+    for (const int offset : m_offsets)
+        visit(c + offset);
+}
+
+// TILE x TILE blocks of cells stored one after the other, tiles in row-major
+// order. Vertical neighbours inside a tile are TILE cells apart instead of a
+// full row, so flood fills on very wide boards stay within a few cache lines.
+// Cells away from the tile edge use fixed offsets; edge cells recompute their
+// neighbours from coordinates.
+template <int TILE = 16>
+class TiledLayout {
+public:
+    static_assert(TILE >= 4 and (TILE & (TILE - 1)) == 0, "TILE must be a power of two, at least 4");
+    static constexpr bool CONTIGUOUS_ROWS = false;
+    static constexpr int NEIGHBOURS = 8;
+
+    TiledLayout(int width, int height);
+
+    size_t size() const;
+    int32_t index(int x, int y) const;
+    int row(int32_t c) const;
+    int column(int32_t c) const;
+
+    template <class Visit>
+    void forEachNeighbour(int32_t c, Visit&& visit) const;
+
+private:
+    static constexpr int SHIFT = std::countr_zero(static_cast<unsigned>(TILE));
+    static constexpr int TILE_CELLS = TILE * TILE;
+
+    int m_tileCols;
+    size_t m_size;
+};
+
+template <int TILE>
+inline TiledLayout<TILE>::TiledLayout(int width, int height)
+    : m_tileCols((width + 2 + TILE - 1) / TILE)
+    , m_size(static_cast<size_t>((height + 2 + TILE - 1) / TILE) * m_tileCols * TILE_CELLS)
+{
+}
+
+template <int TILE>
+inline size_t TiledLayout<TILE>::size() const {
+    return m_size;
+}
+
+template <int TILE>
+inline int32_t TiledLayout<TILE>::index(int x, int y) const {
+    const int px = x + 1, py = y + 1;
+    const int32_t tile = (px >> SHIFT) * m_tileCols + (py >> SHIFT);
+    return tile * TILE_CELLS + ((px & (TILE - 1)) << SHIFT) + (py & (TILE - 1));
+}
+
+template <int TILE>
+inline int TiledLayout<TILE>::row(int32_t c) const {
+    const int32_t tile = c / TILE_CELLS;
+    return (tile / m_tileCols) * TILE + ((c & (TILE_CELLS - 1)) >> SHIFT) - 1;
+}
+
+template <int TILE>
+inline int TiledLayout<TILE>::column(int32_t c) const {
+    const int32_t tile = c / TILE_CELLS;
+    return (tile % m_tileCols) * TILE + (c & (TILE - 1)) - 1;
+}
+
+template <int TILE>
+template <class Visit>
+inline void TiledLayout<TILE>::forEachNeighbour(int32_t c, Visit&& visit) const {
+    const int localX = (c & (TILE_CELLS - 1)) >> SHIFT;
+    const int localY = c & (TILE - 1);
+    if (localX > 0 and localX < TILE - 1 and localY > 0 and localY < TILE - 1)
+    {
+        static constexpr int offsets[8] = {-TILE - 1, -TILE, -TILE + 1, -1, 1, TILE - 1, TILE, TILE + 1};
+        for (const int offset : offsets)
+            visit(c + offset);
+        return;
+    }
+    // On the tile edge a neighbour may sit in one of the eight adjacent tiles
+    for (int dx = -1; dx <= 1; ++dx)
+    {
+        const int nx = localX + dx;
+        const int tileRow = nx < 0 ? -1 : (nx >= TILE ? 1 : 0);
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            if (dx == 0 and dy == 0)
+                continue;
+            const int ny = localY + dy;
+            const int tileCol = ny < 0 ? -1 : (ny >= TILE ? 1 : 0);
+            visit(c + (tileRow * m_tileCols + tileCol) * TILE_CELLS
+                    + (((nx & (TILE - 1)) - localX) << SHIFT) + ((ny & (TILE - 1)) - localY));
+        }
+    }
+}
+
+// D axes, each padded with a border cell on both sides, the last axis varying
+// fastest. A board row is one line of the last axis; the row number is the
+// mixed-radix number of the leading coordinates, the first varying slowest.
+// Rows are runs of cells separated by padding, and the rows -1 and height share
+// a line of padding. A cell's 3^D - 1 neighbours are fixed offsets, border
+// included, so neighbour loops never decode coordinates.
+template <int D>
+class NdLayout {
+public:
+    static_assert(D >= 1, "a board needs at least one axis");
+    static constexpr bool CONTIGUOUS_ROWS = true;
+    static constexpr int NEIGHBOURS = [] {
+        int cells = 1;
+        for (int k = 0; k < D; ++k)
+            cells *= 3;
+        return cells - 1;
+    }();
+
+    explicit NdLayout(const std::array<int, D>& extents);
+
+    size_t size() const;
+    int32_t index(int x, int y) const;
+    int row(int32_t c) const;
+    int column(int32_t c) const;
+
+    template <class Visit>
+    void forEachNeighbour(int32_t c, Visit&& visit) const;
+
+private:
+    int m_stride;                             // padded length of the last axis
+    size_t m_size;
+    vector<int32_t> m_rowStart;               // per row from -1 to height: index of its column 0
+    vector<int32_t> m_lineRow;                // per line of m_stride cells: its row, -1 for padding
+    std::array<int32_t, NEIGHBOURS> m_offsets;
+};
+
+template <int D>
+inline NdLayout<D>::NdLayout(const std::array<int, D>& extents)
+    : m_stride(extents[D - 1] + 2)
+    , m_size(0)
+    , m_offsets{}
+{
+    // Stride of each axis in lines of the last one; a single axis gets a line
+    // of padding on either side, as the rows outside the board need one
+    std::array<long long, D> lineStrides{};
+    long long lines = 1;
+    for (int k = D - 2; k >= 0; --k)
+    {
+        lineStrides[k] = lines;
+        lines *= extents[k] + 2;
+    }
+    if (D == 1)
+        lines = 3;
+    m_size = static_cast<size_t>(lines) * m_stride;
+    m_lineRow.assign(lines, -1);
+
+    // Line 0 is padding on every axis, so it also serves the rows -1 and height
+    int rows = 1;
+    for (int k = 0; k < D - 1; ++k)
+        rows *= extents[k];
+    m_rowStart.assign(rows + 2, 1);
+    for (int x = 0; x < rows; ++x)
+    {
+        long long line = D == 1 ? 1 : 0;
+        for (int k = D - 2, rest = x; k >= 0; --k)
+        {
+            line += (rest % extents[k] + 1) * lineStrides[k];
+            rest /= extents[k];
+        }
+        m_rowStart[x + 1] = static_cast<int32_t>(line * m_stride + 1);
+        m_lineRow[line] = x;
+    }
+
+    // Every combination of -1, 0 and +1 steps along the axes but staying put
+    for (int combination = 0, n = 0; combination <= NEIGHBOURS; ++combination)
+    {
+        if (combination == NEIGHBOURS / 2)
+            continue;
+        long long offset = 0;
+        for (int k = D - 1, rest = combination; k >= 0; --k, rest /= 3)
+            offset += (rest % 3 - 1) * (k == D - 1 ? 1 : lineStrides[k] * m_stride);
+        m_offsets[n++] = static_cast<int32_t>(offset);
+    }
+}
+
+template <int D>
+inline size_t NdLayout<D>::size() const {
+    return m_size;
+}
+
+template <int D>
+inline int32_t NdLayout<D>::index(int x, int y) const {
+    return m_rowStart[x + 1] + y;
+}
+
+template <int D>
+inline int NdLayout<D>::row(int32_t c) const {
+    return m_lineRow[c / m_stride];
+}
+
+template <int D>
+inline int NdLayout<D>::column(int32_t c) const {
+    return c % m_stride - 1;
+}
+
+template <int D>
+template <class Visit>
+inline void NdLayout<D>::forEachNeighbour(int32_t c, Visit&& visit) const {
+    for (const int32_t offset : m_offsets)
+        visit(c + offset);
+}
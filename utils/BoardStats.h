@@ -0,0 +1,33 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Board.h"
+using namespace std;
+
+// Difficulty metrics of a mine layout.
+// An opening is a connected region of zero cells (revealed by one click together
+// with its numbered border); an isolated number is a numbered cell that borders
+// no opening and so needs its own click. 3BV, the minimum number of clicks that
+// clears the board without flags, is their sum.
+struct BoardStats {
+    int openings;
+    int isolatedNumbers;
+    int bbbv;
+
+    // Read from the opening labels the board computes when its mines are placed,
+    // so the board must be initialized
+    static BoardStats compute(const Board& board);
+
+    // Clearing speed for a game that took the given time
+    double bbbvPerSecond(double seconds) const;
+};
+
+inline BoardStats BoardStats::compute(const Board& board) {
+    BoardStats stats{board.getOpeningCount(), board.getIsolatedNumberCount(), 0};
+    stats.bbbv = stats.openings + stats.isolatedNumbers;
+    return stats;
+}
+
+inline double BoardStats::bbbvPerSecond(double seconds) const {
+    return seconds > 0.0 ? bbbv / seconds : 0.0;
+}
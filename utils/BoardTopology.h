@@ -0,0 +1,188 @@
+#pragma once
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// Neighbourhood policies for BasicBoard.
+// A topology names the cells a cell counts mines from, opens into and chords
+// over. The offset tables are constexpr and the policy is a template argument,
+// so every board type compiles its own neighbour loop with no runtime dispatch.
+// Required members:
+//   static constexpr bool LAYOUT_NEIGHBOURS  the neighbours are the ones the layout
+//                                            visits, border included, and the board
+//                                            takes them from there
+//   static constexpr int DEGREE              neighbours of a cell away from the edge
+//   void forEachNeighbour(int x, int y, int width, int height, F&& visit) const
+//                                            visit(nx, ny) for each neighbour on the board;
+//                                            may be static
+// The relation must be symmetric. A board calls forEachNeighbour() on its own
+// copy of the topology, so parameters can live in the topology object; the
+// parameterless ones are default constructed.
+
+// The eight surrounding cells, clipped at the edge of the board
+struct StandardTopology {
+    static constexpr bool LAYOUT_NEIGHBOURS = true;
+    static constexpr int DEGREE = 8;
+    // Clockwise from the cell above
+    static constexpr int OFFSETS[DEGREE][2] = {{-1, 0}, {-1, 1}, {0, 1}, {1, 1}, {1, 0}, {1, -1}, {0, -1}, {-1, -1}};
+
+    template <class Visit>
+    static void forEachNeighbour(int x, int y, int width, int height, Visit&& visit);
+};
+
+// The eight surrounding cells, wrapping around the edges of the board
+// Directions of size below 3 do not wrap, so no cell is counted twice
+struct TorusTopology {
+    static constexpr bool LAYOUT_NEIGHBOURS = false;
+    static constexpr int DEGREE = 8;
+
+    template <class Visit>
+    static void forEachNeighbour(int x, int y, int width, int height, Visit&& visit);
+};
+
+// Hexagonal cells in offset rows: odd rows are shifted half a cell to the right
+struct HexTopology {
+    static constexpr bool LAYOUT_NEIGHBOURS = false;
+    static constexpr int DEGREE = 6;
+    static constexpr int EVEN_ROW_OFFSETS[DEGREE][2] = {{-1, -1}, {-1, 0}, {0, 1}, {1, 0}, {1, -1}, {0, -1}};
+    static constexpr int ODD_ROW_OFFSETS[DEGREE][2] = {{-1, 0}, {-1, 1}, {0, 1}, {1, 1}, {1, 0}, {0, -1}};
+
+    template <class Visit>
+    static void forEachNeighbour(int x, int y, int width, int height, Visit&& visit);
+};
+
+// The cells a chess knight reaches in one move
+struct KnightTopology {
+    static constexpr bool LAYOUT_NEIGHBOURS = false;
+    static constexpr int DEGREE = 8;
+    static constexpr int OFFSETS[DEGREE][2] = {{-2, 1}, {-1, 2}, {1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}};
+
+    template <class Visit>
+    static void forEachNeighbour(int x, int y, int width, int height, Visit&& visit);
+};
+
+// D axes flattened onto the board: the last axis is the column and the others
+// make up the row in mixed radix, the first varying slowest. A cell's
+// neighbours are the 3^D - 1 cells one step away along any set of axes; the
+// board takes them from NdLayout<D>, which it must be stored in.
+template <int D>
+struct NdTopology {
+    static_assert(D >= 1, "a board needs at least one axis");
+
+    static constexpr bool LAYOUT_NEIGHBOURS = true;
+    static constexpr int DEGREE = [] {
+        int cells = 1;
+        for (int k = 0; k < D; ++k)
+            cells *= 3;
+        return cells - 1;
+    }();
+    // Every combination of -1, 0 and +1 steps along the axes but staying put,
+    // the last axis varying fastest
+    static constexpr std::array<std::array<int, D>, DEGREE> STEPS = [] {
+        std::array<std::array<int, D>, DEGREE> steps{};
+        for (int combination = 0, n = 0; combination <= DEGREE; ++combination)
+        {
+            if (combination == DEGREE / 2)
+                continue;
+            for (int k = D - 1, rest = combination; k >= 0; --k, rest /= 3)
+                steps[n][k] = rest % 3 - 1;
+            n += 1;
+        }
+        return steps;
+    }();
+
+    explicit NdTopology(const std::array<int, D>& extents);
+
+    template <class Visit>
+    void forEachNeighbour(int x, int y, int width, int height, Visit&& visit) const;
+
+private:
+    std::array<int, D> m_extents;
+    std::array<int, D> m_rowStrides;  // row step of each axis but the last
+};
+
+template <class Visit>
+inline void StandardTopology::forEachNeighbour(int x, int y, int width, int height, Visit&& visit) {
+    for (const auto& offset : OFFSETS)
+    {
+        const int nx = x + offset[0], ny = y + offset[1];
+        if (nx >= 0 and nx < height and ny >= 0 and ny < width)
+            visit(nx, ny);
+    }
+}
+
+template <class Visit>
+inline void TorusTopology::forEachNeighbour(int x, int y, int width, int height, Visit&& visit) {
+    const bool wrapRows = height >= 3, wrapColumns = width >= 3;
+    for (const auto& offset : StandardTopology::OFFSETS)
+    {
+        int nx = x + offset[0], ny = y + offset[1];
+        if (wrapRows)
+            nx = nx < 0 ? height - 1 : (nx == height ? 0 : nx);
+        if (wrapColumns)
+            ny = ny < 0 ? width - 1 : (ny == width ? 0 : ny);
+        if (nx >= 0 and nx < height and ny >= 0 and ny < width)
+            visit(nx, ny);
+    }
+}
+
+template <class Visit>
+inline void HexTopology::forEachNeighbour(int x, int y, int width, int height, Visit&& visit) {
+    for (const auto& offset : (x & 1) ? ODD_ROW_OFFSETS : EVEN_ROW_OFFSETS)
+    {
+        const int nx = x + offset[0], ny = y + offset[1];
+        if (nx >= 0 and nx < height and ny >= 0 and ny < width)
+            visit(nx, ny);
+    }
+}
+
+template <class Visit>
+inline void KnightTopology::forEachNeighbour(int x, int y, int width, int height, Visit&& visit) {
+    for (const auto& offset : OFFSETS)
+    {
+        const int nx = x + offset[0], ny = y + offset[1];
+        if (nx >= 0 and nx < height and ny >= 0 and ny < width)
+            visit(nx, ny);
+    }
+}
+
+template <int D>
+inline NdTopology<D>::NdTopology(const std::array<int, D>& extents)
+    : m_extents(extents)
+    , m_rowStrides{}
+{
+    for (int k = D - 2, stride = 1; k >= 0; --k)
+    {
+        m_rowStrides[k] = stride;
+        stride *= extents[k];
+    }
+}
+
+template <int D>
+template <class Visit>
+inline void NdTopology<D>::forEachNeighbour(int x, int y, int width, int height, Visit&& visit) const {
+    // Coordinates of the cell on the axes that make up the row; height is
+    // implied by the extents. Board loops take the neighbours from NdLayout, so
+    // this only serves position queries.
+    (void)height;
+    std::array<int, D> coordinates;
+    for (int k = 0, rest = x; k < D - 1; ++k)
+    {
+        coordinates[k] = rest / m_rowStrides[k];
+        rest %= m_rowStrides[k];
+    }
+    for (const auto& step : STEPS)
+    {
+        int nx = x;
+        bool inside = true;
+        for (int k = 0; k < D - 1; ++k)
+        {
+            const int coordinate = coordinates[k] + step[k];
+            inside = inside and coordinate >= 0 and coordinate < m_extents[k];
+            nx += step[k] * m_rowStrides[k];
+        }
+        const int ny = y + step[D - 1];
+        if (inside and ny >= 0 and ny < width)
+            visit(nx, ny);
+    }
+}
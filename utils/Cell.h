@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <stdexcept>  // Include to use std::logic_error
 class Cell {
 public:
@@ -9,35 +11,51 @@ public:
         FLAGGED,
     };
 
+    // Packed cell layout: bits 0-3 adjacent mines, bit 4 mine, bits 5-6 state,
+    // bit 7 a mark that board passes set and clear again before returning
+    static constexpr uint8_t ADJACENT_MASK = 0x0F;
+    static constexpr uint8_t MINE_BIT = 0x10;
+    static constexpr uint8_t MARK_BIT = 0x80;
+    static constexpr int STATE_SHIFT = 5;
+    static constexpr uint8_t STATE_MASK = 0x3 << STATE_SHIFT;
+    static constexpr int PACKED_STATES = 128;
+
+    // Visible state codes: 0-8 revealed number, then the codes below
+    static constexpr uint8_t CODE_HIDDEN = 9;
+    static constexpr uint8_t CODE_FLAG = 10;
+    static constexpr uint8_t CODE_MINE = 11;
+
     Cell();
     void reset();
     bool isMine() const;
     bool isRevealed() const;
     bool isFlagged() const;
+    bool isMarked() const;
     int getAdjacentMines() const;
     Cell::State getState() const;
     void toggleFlag();
-    char getDisplayChar() const; 
-    Cell::State getState();
+    char getDisplayChar() const;
+    uint8_t getPacked() const;
 
     void setAdjacentMines(int count);
     void setMine(bool mine);
     void reveal();
-    
+    void setMarked(bool marked);
+
+    // Display character for any packed state, see getDisplayChar()
+    static char glyph(uint8_t packed);
+    // Visible state code for any packed state; never reveals hidden mines
+    static uint8_t visibleCode(uint8_t packed);
+
 private:
-    bool m_isMine;
-    bool m_isRevealed;
-    bool m_isFlagged;
-    bool m_adjacentMines;
-    Cell::State m_state;
+    static constexpr std::array<char, PACKED_STATES> makeGlyphTable();
+    static constexpr std::array<uint8_t, PACKED_STATES> makeCodeTable();
+
+    uint8_t m_bits;
 };
 
 inline Cell::Cell()
-    : m_isMine(false)
-    , m_isRevealed(false)
-    , m_isFlagged(false)
-    , m_adjacentMines(0)
-    , m_state(State::HIDDEN)
+    : m_bits(0)
 {
     // Initialize cell to default state
     // All member variables should be set to default values
@@ -47,95 +65,132 @@ inline Cell::Cell()
 
 inline bool Cell::isMine() const {
     // Return whether this cell contains a mine
-    return this->m_isMine;
+    return (this->m_bits & MINE_BIT) != 0;
 }
 
 inline bool Cell::isRevealed() const {
     // Return whether this cell is revealed
     // Check if state is REVEALED
-    return this->m_state == State::REVEALED;
+    return this->getState() == State::REVEALED;
 }
 
 inline bool Cell::isFlagged() const {
     // Return whether this cell is flagged
     // Check if state is FLAGGED
-    return this->m_state == State::FLAGGED;
+    return this->getState() == State::FLAGGED;
+}
+
+inline bool Cell::isMarked() const {
+    // Return whether a board pass has marked this cell
+    return (this->m_bits & MARK_BIT) != 0;
 }
 
 inline int Cell::getAdjacentMines() const {
     // Return the number of adjacent mines
-    return this->m_adjacentMines;
-    // throw std::logic_error("getAdjacentMines() function is not yet implemented");
+    return this->m_bits & ADJACENT_MASK;
 }
 
 inline Cell::State Cell::getState() const {
     // Return the current state of the cell
-    return this->m_state;
+    return static_cast<State>((this->m_bits & STATE_MASK) >> STATE_SHIFT);
+}
+
+inline uint8_t Cell::getPacked() const {
+    // Return the whole packed state, usable as an index into per-state tables
+    return this->m_bits;
 }
 
 inline void Cell::setMine(bool mine) {
     // Set whether this cell contains a mine
-    this->m_isMine = mine;
-    // throw std::logic_error("setMine() function is not yet implemented");
+    this->m_bits = mine ? (this->m_bits | MINE_BIT) : (this->m_bits & ~MINE_BIT);
+}
+
+inline void Cell::setMarked(bool marked) {
+    // Set or clear the pass mark
+    this->m_bits = marked ? (this->m_bits | MARK_BIT) : (this->m_bits & ~MARK_BIT);
 }
 
 inline void Cell::setAdjacentMines(int count) {
     // Set the number of adjacent mines
-    this->m_adjacentMines = count;
+    this->m_bits = (this->m_bits & ~ADJACENT_MASK) | (count & ADJACENT_MASK);
 }
 
 inline void Cell::reveal() {
     // Reveal the cell
     // Only reveal if cell is not flagged
-    // Set state to REVEALED and update m_isRevealed
-    if (this->m_state != State::FLAGGED)
+    if (this->getState() != State::FLAGGED)
     {
-        this->m_state = State::REVEALED;
-        this->m_isRevealed = true;
+        this->m_bits = (this->m_bits & ~STATE_MASK) | (State::REVEALED << STATE_SHIFT);
     }
 }
 
 inline void Cell::toggleFlag() {
     // Toggle flag status
-    // If HIDDEN, change to FLAGGED and update m_isFlagged
-    // If FLAGGED, change to HIDDEN and update m_isFlagged
+    // If HIDDEN, change to FLAGGED
+    // If FLAGGED, change to HIDDEN
     // Cannot flag a revealed cell
-    if (this->m_state == State::HIDDEN)
+    if (this->getState() == State::HIDDEN)
     {
-        this->m_state = State::FLAGGED;
-        this->m_isFlagged = true;
+        this->m_bits = (this->m_bits & ~STATE_MASK) | (State::FLAGGED << STATE_SHIFT);
     }
-    else if (this->m_state == State::FLAGGED)
+    else if (this->getState() == State::FLAGGED)
     {
-        this->m_state = State::HIDDEN;
-        this->m_isFlagged = false;
+        this->m_bits = this->m_bits & ~STATE_MASK;
     }
 }
 
 inline void Cell::reset() {
-    // Reset cell to initial state
-    // Set all member variables back to default values
-    this->m_isMine = false;
-    this->m_isRevealed = false;
-    this->m_isFlagged = false;
-    this->m_adjacentMines = 0;
-    this->m_state = State::HIDDEN;
-    // throw std::logic_error("reset() function is not yet implemented");
+    // Reset cell to initial state: hidden, no mine, no adjacent mines
+    this->m_bits = 0;
+}
+
+constexpr std::array<char, Cell::PACKED_STATES> Cell::makeGlyphTable() {
+    // FLAGGED: 'F'
+    // REVEALED and mine: '*'
+    // REVEALED and no adjacent mines: ' ' (space)
+    // REVEALED with adjacent mines: '0' + adjacentMines
+    // HIDDEN: '#'
+    std::array<char, PACKED_STATES> table{};
+    for (int packed = 0; packed < PACKED_STATES; ++packed)
+    {
+        const int state = (packed & STATE_MASK) >> STATE_SHIFT;
+        const int adjacent = packed & ADJACENT_MASK;
+        if (state == State::FLAGGED) table[packed] = 'F';
+        else if (state == State::REVEALED and (packed & MINE_BIT)) table[packed] = '*';
+        else if (state == State::REVEALED)
+            table[packed] = adjacent > 0 ? static_cast<char>('0' + adjacent) : ' ';
+        else if (state == State::HIDDEN) table[packed] = '#';
+        else table[packed] = '?';
+    }
+    return table;
+}
+
+inline char Cell::glyph(uint8_t packed) {
+    static constexpr std::array<char, PACKED_STATES> table = makeGlyphTable();
+    return table[packed & (PACKED_STATES - 1)];
 }
 
 inline char Cell::getDisplayChar() const {
-    // Return character to display for this cell
-    // FLAGGED: return 'F'
-    // REVEALED and mine: return '*'
-    // REVEALED and no adjacent mines: return ' ' (space)
-    // REVEALED with adjacent mines: return '0' + adjacentMines
-    // HIDDEN: return '#'
-    if (this->m_isFlagged) return 'F';
-    else if (this->m_isRevealed and this->m_isMine) return '*';
-    else if (this->m_isRevealed)
-        return this->m_adjacentMines > 0 ? this->m_adjacentMines - '0': ' '; 
-    else if (this->m_state == State::HIDDEN) return '#';
-    else 
-        throw std::logic_error("getDisplayChar() function is not yet implemented");
+    // Return character to display for this cell, looked up by packed state
+    return glyph(this->m_bits);
 }
 
+constexpr std::array<uint8_t, Cell::PACKED_STATES> Cell::makeCodeTable() {
+    // HIDDEN: CODE_HIDDEN, FLAGGED: CODE_FLAG
+    // REVEALED and mine: CODE_MINE, otherwise the adjacent mine count
+    std::array<uint8_t, PACKED_STATES> table{};
+    for (int packed = 0; packed < PACKED_STATES; ++packed)
+    {
+        const int state = (packed & STATE_MASK) >> STATE_SHIFT;
+        if (state == State::FLAGGED) table[packed] = CODE_FLAG;
+        else if (state == State::REVEALED and (packed & MINE_BIT)) table[packed] = CODE_MINE;
+        else if (state == State::REVEALED) table[packed] = static_cast<uint8_t>(packed & ADJACENT_MASK);
+        else table[packed] = CODE_HIDDEN;
+    }
+    return table;
+}
+
+inline uint8_t Cell::visibleCode(uint8_t packed) {
+    static constexpr std::array<uint8_t, PACKED_STATES> table = makeCodeTable();
+    return table[packed & (PACKED_STATES - 1)];
+}
@@ -2,6 +2,8 @@
 
 #include <bits/stdc++.h>
 #include "Board.h"
+#include "BitBoard8.h"
+#include "BoardStats.h"
 
 using namespace std;
 
@@ -24,12 +26,30 @@ public:
         EXPERT
     };
 
+    // One entry of a makeMoves() batch; action is the makeMove() action character
+    struct Move {
+        int x;
+        int y;
+        char action;
+    };
+
+    struct MoveResult {
+        bool success;
+        bool mineHit;
+        int livesLeft;
+    };
+
     explicit Game(Difficulty difficulty);
+    // Same with a fixed seed for the mine placement, for reproducible layouts;
+    // a BEGINNER game draws the layout GameBatch draws from the same seed
+    Game(Difficulty difficulty, uint64_t seed);
     ~Game();
 
     void initializeBoard();
+    void initializeBoard(uint64_t seed);
     void start();
     void restart();
+    void loadBoard(std::unique_ptr<Board> board);
     void setMaxLives(int maxLives);
     void resetLives();
     void displayBoard() const;
@@ -39,8 +59,18 @@ public:
     void getDifficultySettings(int& width, int& height, int& mines) const; 
     void loseLife(); 
     void continueAfterLifeLost(); 
+    void handleMinesHit(int count);
+    int applyAction(int x, int y, char action, bool& success);
+    bool beginBatch();
+    void endBatch(int minesHit, std::chrono::steady_clock::time_point begin);
     
     bool makeMove(int x, int y, char action);
+    bool makeMove(int x, int y, char action, BoardDelta& delta);
+    size_t makeMoves(std::span<const Move> moves, std::span<MoveResult> results);
+    int revealCells(std::span<const std::pair<int, int>> cells);
+    int revealRect(int x0, int y0, int x1, int y1);
+    int flagCells(std::span<const std::pair<int, int>> cells);
+    int flagRect(int x0, int y0, int x1, int y1);
     bool isGameOver() const;
     bool hasLivesRemaining() const;
 
@@ -48,14 +78,38 @@ public:
     
     int getLives() const;
     int getMaxLives() const;
+    // Mines opened by the last makeMove(), revealCells() or revealRect(), for
+    // the caller to report; makeMoves() reports them per move in its results
+    int getLastMinesHit() const;
 
     Game::GameState getState() const;
     
+    // BEGINNER games are played on the bitboard engine alone; the Board is a
+    // mirror built and brought up to date by each call, so a pointer kept
+    // across moves shows the board as of the call that returned it
     Board* getBoard(); 
     const Board* getBoard() const; 
+    size_t memoryUsage() const;
+    const BoardStats* getBoardStats() const;
     
 private:
-    Board *m_board;
+    // BEGINNER games are played on the BitBoard8 engine; the Board mirrors it
+    // on demand, see mirror()
+    void attachBitBoard();
+    int applyBitBoardAction(int x, int y, char action, bool& success);
+    uint64_t revealOnBitBoard(uint64_t mask, int firstX, int firstY, int& minesHit);
+    Board* mirror() const;
+    static uint64_t nextSeed();
+    static uint64_t rectMask(int x0, int y0, int x1, int y1);
+    bool isBoardWon() const;
+
+    std::unique_ptr<BitBoard8> m_bitBoard;
+    // Owned board; with the engine it is a mirror that may not exist yet or
+    // lag behind the engine (m_mirrorStale), and m_mirrorHasMines tells
+    // whether it holds the engine's layout
+    mutable Board *m_board;
+    mutable bool m_mirrorStale;
+    mutable bool m_mirrorHasMines;
     GameState m_gameState;
     Difficulty m_difficulty;
     bool m_firstMove;
@@ -63,20 +117,33 @@ private:
     int m_maxLives;
     chrono::steady_clock::time_point m_startTime;
     chrono::steady_clock::time_point m_endTime;
+    mutable BoardStats m_boardStats;
+    mutable bool m_hasBoardStats;
+    int m_lastMinesHit;
 };
 
 inline Game::Game(const Difficulty difficulty)
+    : Game(difficulty, nextSeed())
+{
+}
+
+inline Game::Game(const Difficulty difficulty, uint64_t seed)
     : m_board(nullptr)
+    , m_mirrorStale(false)
+    , m_mirrorHasMines(false)
     , m_gameState(GameState::NOT_STARTED)
     , m_difficulty(difficulty)
     , m_firstMove(true)
     , m_lives(DEFAULT_MAX_LIVES)
     , m_maxLives(DEFAULT_MAX_LIVES)
+    , m_boardStats{0, 0, 0}
+    , m_hasBoardStats(false)
+    , m_lastMinesHit(0)
 {
     // Minimal constructor implementation to prevent test skips
     // Create a basic board to prevent segfaults, but other functions will still throw
     try {
-        initializeBoard();
+        initializeBoard(seed);
     } catch (const std::logic_error&) {
         // Fallback: create a minimal board to prevent crashes
         m_board = new Board(8, 8, 10);
@@ -92,9 +159,10 @@ inline void Game::start() {
     // 1. Set game state to IN_PROGRESS
     m_gameState = GameState::IN_PROGRESS;
     // 2. Record start time using std::chrono::steady_clock::now()
-    m_startTime = std::chrono::high_resolution_clock::now();
+    m_startTime = std::chrono::steady_clock::now();
     // 3. Set m_firstMove to true
     m_firstMove = true;
+    Metrics::add(Metrics::GAMES_STARTED);
 }
 
 inline void Game::restart() {
@@ -102,6 +170,19 @@ inline void Game::restart() {
     initializeBoard();
     m_gameState = GameState::NOT_STARTED;
     m_firstMove = true;
+    m_hasBoardStats = false;
+    resetLives();
+}
+
+inline void Game::loadBoard(std::unique_ptr<Board> board) {
+    // Start a new game on a board prepared elsewhere (e.g. by BoardGenerator)
+    // The board may already hold its mines; the bitboard engine takes them over
+    delete m_board;
+    m_board = board.release();
+    attachBitBoard();
+    m_gameState = GameState::NOT_STARTED;
+    m_firstMove = true;
+    m_hasBoardStats = false;
     resetLives();
 }
 
@@ -116,7 +197,7 @@ inline bool Game::isGameOver() const {
 }
 
 inline double Game::getElapsedTime() {
-    m_endTime = std::chrono::high_resolution_clock::now();
+    m_endTime = std::chrono::steady_clock::now();
     return std::chrono::duration<double>(m_endTime - m_startTime).count();
 }
 
@@ -130,6 +211,10 @@ inline int Game::getMaxLives() const {
     return m_maxLives;
 }
 
+inline int Game::getLastMinesHit() const {
+    return m_lastMinesHit;
+}
+
 inline bool Game::hasLivesRemaining() const {
     // Return true if player has lives remaining (this works)
     return m_lives > 0;
@@ -150,27 +235,98 @@ inline void Game::resetLives() {
 
 inline void Game::displayBoard() const {
     // Display the game board
-    if ( m_board == nullptr ) {
+    const Board* board = mirror();
+    if ( board == nullptr ) {
         return;
     }
-    m_board->display();
+    board->display();
 }
 
 inline Board* Game::getBoard() {
     // Return pointer to board (this works to prevent segfaults)
-    return m_board;
+    return mirror();
 }
 
 inline const Board* Game::getBoard() const {
     // Return const pointer to board (this works to prevent segfaults)
-    return m_board;
+    return mirror();
+}
+
+inline const BoardStats* Game::getBoardStats() const {
+    // 3BV and openings of the current layout, nullptr until the first reveal
+    // placed the mines; computed on the first call, from the Board's openings
+    const bool placed = m_bitBoard ? m_bitBoard->getRevealed() != 0 : m_board->getRevealedCount() > 0;
+    if (!m_hasBoardStats && placed) {
+        m_boardStats = BoardStats::compute(*mirror());
+        m_hasBoardStats = true;
+    }
+    return m_hasBoardStats ? &m_boardStats : nullptr;
+}
+
+inline size_t Game::memoryUsage() const {
+    // Total bytes used by this session: the game object plus its board
+    size_t total = sizeof(Game);
+    if (m_board != nullptr) {
+        total += m_board->memoryUsage().total();
+    }
+    if (m_bitBoard) {
+        total += sizeof(BitBoard8);
+    }
+    return total;
 }
 
 inline void Game::initializeBoard() {
+    initializeBoard(nextSeed());
+}
+
+inline void Game::initializeBoard(uint64_t seed) {
     // Initialize board based on difficulty
+    // BEGINNER games start on the bitboard engine alone, the Board follows on demand
     int width, height, minesCnt;
     getDifficultySettings(width, height, minesCnt);
-    m_board = new Board(width, height, minesCnt);
+    if (m_difficulty == Difficulty::BEGINNER && width == BitBoard8::SIZE && height == BitBoard8::SIZE) {
+        m_bitBoard = std::make_unique<BitBoard8>(minesCnt, seed);
+        m_board = nullptr;
+        m_mirrorStale = true;
+        m_mirrorHasMines = false;
+        return;
+    }
+    m_board = new Board(width, height, minesCnt, seed);
+    m_bitBoard.reset();
+}
+
+inline uint64_t Game::nextSeed() {
+    // Seed for an engine's mine placement; random_device costs microseconds per
+    // call, so it seeds one SplitMix64 stream per thread
+    thread_local uint64_t state = [] {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }();
+    return SplitMix64::next(state);
+}
+
+inline void Game::attachBitBoard() {
+    // BEGINNER games on an 8x8 board run on the bitboard engine
+    // Mines already on the board (a loaded layout) are handed to the engine,
+    // and the board becomes its mirror
+    m_bitBoard.reset();
+    m_mirrorStale = false;
+    m_mirrorHasMines = false;
+    if (m_difficulty != Difficulty::BEGINNER || m_board->getWidth() != BitBoard8::SIZE ||
+        m_board->getHeight() != BitBoard8::SIZE) {
+        return;
+    }
+    m_bitBoard = std::make_unique<BitBoard8>(m_board->getMineCount(), nextSeed());
+    uint64_t mines = 0;
+    for (int i = 0; i < BitBoard8::SIZE; ++i) {
+        for (int j = 0; j < BitBoard8::SIZE; ++j) {
+            mines |= m_board->isMineAt(i, j) ? BitBoard8::bit(i, j) : 0;
+        }
+    }
+    if (mines != 0) {
+        m_bitBoard->loadMines(mines);
+        m_mirrorHasMines = true;
+    }
 }
 
 inline void Game::getDifficultySettings(int& width, int& height, int& mines) const {
@@ -190,9 +346,9 @@ inline void Game::getDifficultySettings(int& width, int& height, int& mines) con
             mines = 30;
             break;
         case Game::Difficulty::EXPERT:
-            width = 14;
-            height = 14;
-            mines = 30;
+            width = 20;
+            height = 20;
+            mines = 80;
             break;
         default:
             width = 8;
@@ -206,69 +362,480 @@ inline void Game::loseLife() {
     // Reduce lives by 1 if lives > 0
     if (m_lives > 0) {
         m_lives--;
+        Metrics::add(Metrics::LIVES_CONSUMED);
     }
 }
 
 
 inline bool Game::makeMove(int x, int y, char action) {
-    // TODO: Make a move in the game
+    // Make a move in the game
     // 1. If game not started, call start()
     // 2. If game is over, return false
     // 3. Handle action 'r'/'R' for reveal:
     //    - Call board->revealCell(x, y)
     //    - If unsuccessful and cell is a mine (Lives System):
     //      * Call loseLife() to reduce lives
-    //      * If hasLivesRemaining(), continue game and show mine hit message
+    //      * If hasLivesRemaining(), continue game; getLastMinesHit() tells the caller
     //      * If no lives left, set state to LOST and record end time
     // 4. Handle action 'f'/'F' for flag:
     //    - Call board->toggleFlag(x, y)
-    // 5. Call updateGameState() to check win/loss conditions
-    // 6. Set m_firstMove to false
-    throw std::logic_error("makeMove() function is not yet implemented");
+    // 5. Handle action 'c'/'C' for chord:
+    //    - Call board->chordCell(x, y), every mine it opens costs a life
+    // 6. Call updateGameState() to check win/loss conditions
+    // 7. Set m_firstMove to false
+    if (m_gameState == GameState::NOT_STARTED) {
+        start();
+    }
+    m_lastMinesHit = 0;
+    if (isGameOver()) {
+        return false;
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    bool success = false;
+    const int minesHit = applyAction(x, y, action, success);
+    if (minesHit > 0) {
+        handleMinesHit(minesHit);
+    }
+
+    updateGameState();
+    m_firstMove = false;
+    Metrics::add(Metrics::MOVES);
+    Metrics::observe(Metrics::MOVE_LATENCY, std::chrono::steady_clock::now() - begin);
+    return success;
+}
+
+inline int Game::applyAction(int x, int y, char action, bool& success) {
+    // Apply one action to the board without touching lives or game state
+    // Returns the number of mines the action opened
+    if (m_bitBoard) {
+        return applyBitBoardAction(x, y, action, success);
+    }
+    success = false;
+    int minesHit = 0;
+    switch (action) {
+        case 'r':
+        case 'R': {
+            // Only a cell hidden before this move can cost a life
+            const bool wasHidden = m_board->isValidPosition(x, y) && !m_board->getCell(x, y).isRevealed();
+            success = m_board->revealCell(x, y);
+            if (!success && wasHidden && m_board->getCell(x, y).isRevealed() && m_board->getCell(x, y).isMine()) {
+                minesHit = 1;
+            }
+            break;
+        }
+        case 'f':
+        case 'F':
+            success = m_board->toggleFlag(x, y);
+            break;
+        case 'c':
+        case 'C':
+            success = m_board->chordCell(x, y, minesHit);
+            break;
+        default:
+            break;
+    }
+    return minesHit;
+}
+
+inline int Game::applyBitBoardAction(int x, int y, char action, bool& success) {
+    // applyAction() on the bitboard engine, with the same results as the Board rules
+    success = false;
+    int minesHit = 0;
+    if (!BitBoard8::isValidPosition(x, y)) {
+        return 0;
+    }
+    switch (action) {
+        case 'r':
+        case 'R': {
+            const uint64_t opened = revealOnBitBoard(BitBoard8::bit(x, y), x, y, minesHit);
+            success = opened != 0 && minesHit == 0;
+            break;
+        }
+        case 'f':
+        case 'F':
+            success = m_bitBoard->toggleFlag(x, y);
+            m_mirrorStale = m_mirrorStale || success;
+            break;
+        case 'c':
+        case 'C': {
+            const uint64_t opened = m_bitBoard->chord(x, y, minesHit);
+            m_mirrorStale = m_mirrorStale || opened != 0;
+            success = opened != 0;
+            break;
+        }
+        default:
+            break;
+    }
+    return minesHit;
+}
+
+inline uint64_t Game::revealOnBitBoard(uint64_t mask, int firstX, int firstY, int& minesHit) {
+    // The first reveal places the mines
+    // (firstX, firstY) must be a hidden, unflagged cell of mask; a reveal with no
+    // such cell does nothing and, as on Board, leaves the mines unplaced
+    if ((mask & ~m_bitBoard->getFlagged() & ~m_bitBoard->getRevealed()) == 0) {
+        return 0;
+    }
+    if (!m_bitBoard->isInitialized()) {
+        m_bitBoard->placeMines(firstX, firstY);
+    }
+    const uint64_t opened = m_bitBoard->reveal(mask, minesHit);
+    m_mirrorStale = m_mirrorStale || opened != 0;
+    return opened;
+}
+
+inline Board* Game::mirror() const {
+    // The game's Board; with the engine it is built on first use and brought up
+    // to date here: the layout once the engine has one (its adjacency and
+    // openings computed then), then every cell whose state differs, through
+    // syncCell() so display, delta and minimap see the changes
+    if (!m_bitBoard || !m_mirrorStale) {
+        return m_board;
+    }
+    if (m_board == nullptr) {
+        int width, height, minesCnt;
+        getDifficultySettings(width, height, minesCnt);
+        m_board = new Board(width, height, minesCnt, 0);
+    }
+    if (m_bitBoard->isInitialized() && !m_mirrorHasMines) {
+        std::vector<std::pair<int, int>> mines;
+        for (uint64_t rest = m_bitBoard->getMines(); rest != 0; rest &= rest - 1) {
+            const int index = std::countr_zero(rest);
+            mines.push_back({index / BitBoard8::SIZE, index % BitBoard8::SIZE});
+        }
+        m_board->loadMines(mines);
+        m_mirrorHasMines = true;
+    }
+    const uint64_t revealed = m_bitBoard->getRevealed();
+    const uint64_t flagged = m_bitBoard->getFlagged();
+    for (int index = 0; index < BitBoard8::SIZE * BitBoard8::SIZE; ++index) {
+        const int x = index / BitBoard8::SIZE, y = index % BitBoard8::SIZE;
+        const Cell::State state = ((revealed >> index) & 1) ? Cell::REVEALED
+                                  : ((flagged >> index) & 1) ? Cell::FLAGGED : Cell::HIDDEN;
+        if (m_board->getCell(x, y).getState() != state) {
+            m_board->syncCell(x, y, state);
+        }
+    }
+    m_mirrorStale = false;
+    return m_board;
+}
+
+inline uint64_t Game::rectMask(int x0, int y0, int x1, int y1) {
+    // Cells of the inclusive rectangle (x0, y0)-(x1, y1) clipped to the 8x8 board
+    const int top = std::max(0, std::min(x0, x1));
+    const int left = std::max(0, std::min(y0, y1));
+    const int bottom = std::min(BitBoard8::SIZE - 1, std::max(x0, x1));
+    const int right = std::min(BitBoard8::SIZE - 1, std::max(y0, y1));
+    if (top > bottom || left > right) {
+        return 0;
+    }
+    const uint64_t columns = ((2ULL << right) - 1) & ~((1ULL << left) - 1);
+    uint64_t mask = 0;
+    for (int i = top; i <= bottom; ++i) {
+        mask |= columns << (i * BitBoard8::SIZE);
+    }
+    return mask;
+}
+
+inline bool Game::isBoardWon() const {
+    return m_bitBoard ? m_bitBoard->isWon() : m_board->isGameWon();
+}
+
+inline size_t Game::makeMoves(std::span<const Move> moves, std::span<MoveResult> results) {
+    // Apply a sequence of moves, writing one result per applied move
+    // Lives are charged per move, but timer reads, game state evaluation and
+    // metrics happen once for the whole batch. Win is checked with the board's
+    // O(1) counters so the batch stops right after the move that ends the game.
+    // Returns the number of moves applied (and results written)
+    if (m_gameState == GameState::NOT_STARTED) {
+        start();
+    }
+    if (isGameOver()) {
+        return 0;
+    }
+
+    const size_t count = std::min(moves.size(), results.size());
+    size_t applied = 0;
+    while (applied < count) {
+        const Move& move = moves[applied];
+        MoveResult& result = results[applied];
+        const int minesHit = applyAction(move.x, move.y, move.action, result.success);
+        for (int i = 0; i < minesHit; ++i) {
+            loseLife();
+        }
+        result.mineHit = minesHit > 0;
+        result.livesLeft = m_lives;
+        ++applied;
+        if (!hasLivesRemaining() || isBoardWon()) {
+            break;
+        }
+    }
+
+    if (!hasLivesRemaining()) {
+        m_gameState = GameState::LOST;
+        m_endTime = std::chrono::steady_clock::now();
+        Metrics::add(Metrics::GAMES_LOST);
+    }
+    updateGameState();
+    m_firstMove = false;
+    Metrics::add(Metrics::MOVES, applied);
+    return applied;
+}
+
+inline bool Game::makeMove(int x, int y, char action, BoardDelta& delta) {
+    // Same as makeMove(), and fills delta with every cell whose visible state changed
+    // The delta is cleared first; its capacity is kept so steady play does not allocate
+    // A bitboard game's mirror is brought up to date before the move, and after
+    // it with the delta attached, so the delta holds exactly this move's changes
+    delta.clear();
+    Board* board = mirror();
+    board->setDelta(&delta);
+    bool success;
+    try {
+        success = makeMove(x, y, action);
+        mirror();
+    } catch (...) {
+        board->setDelta(nullptr);
+        throw;
+    }
+    board->setDelta(nullptr);
+    return success;
+}
+
+inline bool Game::beginBatch() {
+    // Shared prologue of the batch operations: start the game, refuse once it is over
+    if (m_gameState == GameState::NOT_STARTED) {
+        start();
+    }
+    m_lastMinesHit = 0;
+    return !isGameOver();
+}
+
+inline void Game::endBatch(int minesHit, std::chrono::steady_clock::time_point begin) {
+    // Lives and win/lose evaluation run once for the whole batch
+    if (minesHit > 0) {
+        handleMinesHit(minesHit);
+    }
+    updateGameState();
+    m_firstMove = false;
+    Metrics::add(Metrics::MOVES);
+    Metrics::observe(Metrics::MOVE_LATENCY, std::chrono::steady_clock::now() - begin);
+}
+
+inline int Game::revealCells(std::span<const std::pair<int, int>> cells) {
+    // Reveal a list of cells as one move; returns the number of cells revealed
+    if (!beginBatch()) {
+        return 0;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    int minesHit = 0;
+    int revealed = 0;
+    if (m_bitBoard) {
+        uint64_t mask = 0;
+        const std::pair<int, int>* first = nullptr;
+        for (const auto& cell : cells) {
+            if (BitBoard8::isValidPosition(cell.first, cell.second)) {
+                const uint64_t bit = BitBoard8::bit(cell.first, cell.second);
+                mask |= bit;
+                if (first == nullptr && !(m_bitBoard->getFlagged() & bit)) {
+                    first = &cell;
+                }
+            }
+        }
+        if (first != nullptr) {
+            revealed = std::popcount(revealOnBitBoard(mask, first->first, first->second, minesHit));
+        }
+    } else {
+        revealed = m_board->revealCells(cells, minesHit);
+    }
+    endBatch(minesHit, begin);
+    return revealed;
+}
+
+inline int Game::revealRect(int x0, int y0, int x1, int y1) {
+    // Reveal the inclusive rectangle (x0, y0)-(x1, y1) as one move
+    if (!beginBatch()) {
+        return 0;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    int minesHit = 0;
+    int revealed = 0;
+    if (m_bitBoard) {
+        // The first unflagged cell in row-major order is the protected first click
+        const uint64_t mask = rectMask(x0, y0, x1, y1);
+        const uint64_t unflagged = mask & ~m_bitBoard->getFlagged();
+        if (unflagged != 0) {
+            const int first = std::countr_zero(unflagged);
+            revealed = std::popcount(revealOnBitBoard(mask, first / BitBoard8::SIZE, first % BitBoard8::SIZE, minesHit));
+        }
+    } else {
+        revealed = m_board->revealRect(x0, y0, x1, y1, minesHit);
+    }
+    endBatch(minesHit, begin);
+    return revealed;
+}
+
+inline int Game::flagCells(std::span<const std::pair<int, int>> cells) {
+    // Flag a list of hidden cells as one move; returns the number flagged
+    if (!beginBatch()) {
+        return 0;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    int flagged = 0;
+    if (m_bitBoard) {
+        uint64_t mask = 0;
+        for (const auto& cell : cells) {
+            if (BitBoard8::isValidPosition(cell.first, cell.second)) {
+                mask |= BitBoard8::bit(cell.first, cell.second);
+            }
+        }
+        const uint64_t newlyFlagged = m_bitBoard->flag(mask);
+        m_mirrorStale = m_mirrorStale || newlyFlagged != 0;
+        flagged = std::popcount(newlyFlagged);
+    } else {
+        flagged = m_board->flagCells(cells);
+    }
+    endBatch(0, begin);
+    return flagged;
+}
+
+inline int Game::flagRect(int x0, int y0, int x1, int y1) {
+    // Flag every hidden cell of the inclusive rectangle as one move
+    if (!beginBatch()) {
+        return 0;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    int flagged = 0;
+    if (m_bitBoard) {
+        const uint64_t newlyFlagged = m_bitBoard->flag(rectMask(x0, y0, x1, y1));
+        m_mirrorStale = m_mirrorStale || newlyFlagged != 0;
+        flagged = std::popcount(newlyFlagged);
+    } else {
+        flagged = m_board->flagRect(x0, y0, x1, y1);
+    }
+    endBatch(0, begin);
+    return flagged;
+}
+
+inline void Game::handleMinesHit(int count) {
+    // Lives System: every mine opened by the move costs one life
+    // The game continues while lives remain, otherwise it is lost
+    // Reporting the hit is left to the caller, see getLastMinesHit()
+    m_lastMinesHit = count;
+    for (int i = 0; i < count; ++i) {
+        loseLife();
+    }
+    if (hasLivesRemaining()) {
+        continueAfterLifeLost();
+    } else {
+        m_gameState = GameState::LOST;
+        m_endTime = std::chrono::steady_clock::now();
+        Metrics::add(Metrics::GAMES_LOST);
+    }
 }
 
 inline void Game::updateGameState() {
-    // TODO: Update game state based on board conditions
+    // Update game state based on board conditions
     // 1. If game is IN_PROGRESS:
     //    - Check if board->isGameWon(), set state to WON and record end time
     // NOTE: With lives system, don't check isGameLost() here anymore
     // Mine hits are handled in makeMove() and only end game when lives run out
-    throw std::logic_error("updateGameState() function is not yet implemented");
+    // The layout's difficulty metrics wait for getBoardStats()
+    if (m_gameState == GameState::IN_PROGRESS && isBoardWon()) {
+        m_gameState = GameState::WON;
+        m_endTime = std::chrono::steady_clock::now();
+        Metrics::add(Metrics::GAMES_WON);
+    }
 }
 inline void Game::continueAfterLifeLost() {
-    // TODO: Handle continuation after life lost
+    // Handle continuation after life lost
     // The mine that was hit remains revealed as a warning
     // The game continues in IN_PROGRESS state
     // No other changes needed - player can continue from current state
-    throw std::logic_error("continueAfterLifeLost() function is not yet implemented");
+    m_gameState = GameState::IN_PROGRESS;
 }
 
 inline void Game::displayHelp() const {
-    // TODO: Display help information
+    // Display help information
     // Show available commands, game legend, objective, and lives system info:
     // 1. Commands (reveal, flag, help, quit, new game, debug)
     // 2. Legend (symbols and their meanings)
-    // 3. Lives System explanation:
-    //    - Starting lives count
-    //    - Life loss on mine hit
-    //    - Continuation after mine hit
-    //    - Game over when all lives lost
+    // 3. Lives System explanation
     // 4. Objective (reveal all non-mine cells)
-    throw std::logic_error("displayHelp() function is not yet implemented");
+    std::cout << "Commands:\n"
+              << "  r <x> <y>  Reveal the cell at row x, column y\n"
+              << "  f <x> <y>  Flag or unflag the cell at row x, column y\n"
+              << "  c <x> <y>  Chord: on a number with that many flags around it, open the other neighbours\n"
+              << "  b r|f <x0> <y0> <x1> <y1>  Reveal or flag every cell of a rectangle at once\n"
+              << "  l [n]      Show lives, or set max lives to n\n"
+              << "  n          Start a new game\n"
+              << "  g <min> <max>  Start a new game whose 3BV lies in [min, max]\n"
+              << "  d          Show the debug view (all mines)\n"
+              << "  h          Show this help\n"
+              << "  q          Quit\n"
+              << "Legend: # hidden, F flag, * mine, 1-8 adjacent mines, blank no adjacent mines\n"
+              << "Lives: you start with " << m_maxLives << " lives. Hitting a mine costs one life,\n"
+              << "       the mine stays revealed and the game continues until all lives are lost.\n"
+              << "Objective: reveal every cell that does not contain a mine.\n";
 }
 
 
 inline void Game::displayGameInfo() const {
-    // TODO: Display game information
+    // Display game information
     // 1. Show difficulty level name (BEGINNER/INTERMEDIATE/EXPERT)
     // 2. Show grid dimensions and mine count
     // 3. Show flag count and remaining mines
-    // 4. Show lives information (current/max lives) - NEW for lives system
-    // 5. Show elapsed time
-    // 6. Show current game status with lives-specific messages:
-    //    - For IN_PROGRESS: warn if lives lost
-    //    - For WON: show lives used if any
-    //    - For LOST: show lives-specific game over message
-    throw std::logic_error("displayGameInfo() function is not yet implemented");
-}
+    // 4. Show lives information (current/max lives)
+    // 5. Show elapsed time, and 3BV once the mines are placed (3BV/s after a win)
+    // 6. Show current game status with lives-specific messages
+    static const char* levelNames[] = {"BEGINNER", "INTERMEDIATE", "EXPERT"};
+    double elapsed = 0.0;
+    if (m_gameState == GameState::IN_PROGRESS) {
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+    } else if (isGameOver()) {
+        elapsed = std::chrono::duration<double>(m_endTime - m_startTime).count();
+    }
 
+    const Board& board = *mirror();
+    std::cout << "Level: " << levelNames[m_difficulty]
+              << " | Grid: " << board.getWidth() << "x" << board.getHeight()
+              << " | Mines: " << board.getMineCount()
+              << " | Flags: " << board.getFlagCount()
+              << " | Remaining: " << board.getMineCount() - board.getFlagCount() << '\n';
+    std::cout << "Lives: " << m_lives << "/" << m_maxLives
+              << " | Time: " << static_cast<long>(elapsed) << "s" << '\n';
+    if (const BoardStats* stats = getBoardStats()) {
+        std::cout << "3BV: " << stats->bbbv
+                  << " | Openings: " << stats->openings
+                  << " | Isolated numbers: " << stats->isolatedNumbers;
+        if (m_gameState == GameState::WON) {
+            std::cout << " | 3BV/s: " << std::fixed << std::setprecision(2)
+                      << stats->bbbvPerSecond(elapsed) << std::defaultfloat;
+        }
+        std::cout << '\n';
+    }
+
+    switch (m_gameState) {
+        case GameState::NOT_STARTED:
+            std::cout << "Status: Ready - reveal a cell to start" << '\n';
+            break;
+        case GameState::IN_PROGRESS:
+            std::cout << "Status: In progress";
+            if (m_lives < m_maxLives) {
+                std::cout << " - careful, " << (m_maxLives - m_lives) << " life lost";
+            }
+            std::cout << '\n';
+            break;
+        case GameState::WON:
+            std::cout << "Status: Won";
+            if (m_lives < m_maxLives) {
+                std::cout << " using " << (m_maxLives - m_lives) << " extra lives";
+            }
+            std::cout << '\n';
+            break;
+        case GameState::LOST:
+            std::cout << "Status: Lost - all " << m_maxLives << " lives used" << '\n';
+            break;
+    }
+}
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Game.h"
+#include "SplitMix64.h"
+using namespace std;
+
+// K games of identical size stepped in lockstep, stored as structure of arrays.
+// Cells use the packed Cell layout (one byte per cell) in one contiguous block,
+// and per-game counters live in parallel arrays, so there are no per-game heap
+// objects. Rules follow Game: the first reveal is always safe, a mine costs a
+// life and stays revealed, the game is lost when lives run out and won when
+// every non-mine cell is revealed. Finished games are reset automatically at the
+// end of the step that finished them, with mines drawn from the game's own
+// seeded generator.
+//
+// Reward per step: +1 for a win, -1 for every mine hit, otherwise the newly
+// revealed safe cells as a fraction of all safe cells.
+class GameBatch {
+public:
+    enum ActionType : uint8_t
+    {
+        REVEAL,
+        FLAG,
+        CHORD
+    };
+
+    // One action per game per step; cell is x * width + y
+    struct Action {
+        int32_t cell;
+        uint8_t type;
+    };
+
+    GameBatch(int count, int width, int height, int mines, uint64_t seed, int maxLives = DEFAULT_MAX_LIVES);
+
+    void step(std::span<const Action> actions);
+    void reset(int game);
+    void resetAll();
+
+    int getCount() const;
+    int getWidth() const;
+    int getHeight() const;
+    int getLives(int game) const;
+    int getRevealedCount(int game) const;
+
+    // Results of the last step, one entry per game
+    std::span<const float> rewards() const;
+    std::span<const uint8_t> done() const;
+    std::span<const uint8_t> won() const;
+
+    // Visible state codes (see Cell::visibleCode) of every game, game-major
+    bool observe(std::span<uint8_t> out) const;
+
+private:
+    void placeMines(int game, int firstClick);
+    int openCell(uint8_t* cells, int cell, int& minesHit);
+    int floodFill(uint8_t* cells);
+    int chord(uint8_t* cells, int cell, int& minesHit);
+
+    int m_count;
+    int m_width;
+    int m_height;
+    int m_cellCount;
+    int m_mines;
+    int m_maxLives;
+
+    // Per-cell data, m_count blocks of m_cellCount bytes
+    vector<uint8_t> m_cells;
+
+    // Per-game data
+    vector<int32_t> m_safeRevealed;
+    vector<int32_t> m_lives;
+    vector<uint8_t> m_initialized;
+    vector<uint64_t> m_rngState;
+    vector<float> m_rewards;
+    vector<uint8_t> m_done;
+    vector<uint8_t> m_won;
+
+    // Shared by all games: neighbour table (8 slots per cell, -1 padded) and scratch
+    vector<int32_t> m_neighbours;
+    vector<int32_t> m_stack;
+    vector<int32_t> m_positions;
+};
+
+inline GameBatch::GameBatch(int count, int width, int height, int mines, uint64_t seed, int maxLives)
+    : m_count(count)
+    , m_width(width)
+    , m_height(height)
+    , m_cellCount(width * height)
+    , m_mines(std::min(mines, width * height - 1))
+    , m_maxLives(std::max(1, maxLives))
+    , m_cells(static_cast<size_t>(count) * width * height)
+    , m_safeRevealed(count)
+    , m_lives(count)
+    , m_initialized(count)
+    , m_rngState(count)
+    , m_rewards(count)
+    , m_done(count)
+    , m_won(count)
+    , m_neighbours(static_cast<size_t>(width) * height * 8, -1)
+    , m_stack()
+    , m_positions(static_cast<size_t>(width) * height)
+{
+    // Precompute the in-bounds neighbours of every cell once for all games,
+    // in the order of Board's StandardTopology
+    for (int x = 0; x < m_height; ++x) {
+        for (int y = 0; y < m_width; ++y) {
+            int32_t* slots = &m_neighbours[static_cast<size_t>(x * m_width + y) * 8];
+            int used = 0;
+            StandardTopology::forEachNeighbour(x, y, m_width, m_height, [&](int nx, int ny) {
+                slots[used++] = nx * m_width + ny;
+            });
+        }
+    }
+    m_stack.reserve(m_cellCount);
+
+    // Independent generator streams: splitmix64 of the seed and the game index
+    for (int game = 0; game < m_count; ++game) {
+        m_rngState[game] = SplitMix64::stream(seed, game);
+    }
+    resetAll();
+}
+
+inline void GameBatch::reset(int game) {
+    std::fill_n(m_cells.data() + static_cast<size_t>(game) * m_cellCount, m_cellCount, uint8_t{0});
+    m_safeRevealed[game] = 0;
+    m_lives[game] = m_maxLives;
+    m_initialized[game] = 0;
+}
+
+inline void GameBatch::resetAll() {
+    for (int game = 0; game < m_count; ++game) {
+        reset(game);
+        m_rewards[game] = 0.0f;
+        m_done[game] = 0;
+        m_won[game] = 0;
+    }
+}
+
+inline void GameBatch::placeMines(int game, int firstClick) {
+    // Same distribution as Board::placeMines: a uniform choice of m_mines cells
+    // among all cells but the first click (partial Fisher-Yates)
+    uint8_t* cells = m_cells.data() + static_cast<size_t>(game) * m_cellCount;
+    int available = 0;
+    for (int cell = 0; cell < m_cellCount; ++cell) {
+        if (cell != firstClick) {
+            m_positions[available++] = cell;
+        }
+    }
+    uint64_t& state = m_rngState[game];
+    for (int i = 0; i < m_mines; ++i) {
+        const int pick = i + static_cast<int>(SplitMix64::below(state, static_cast<uint64_t>(available - i)));
+        std::swap(m_positions[i], m_positions[pick]);
+        const int mine = m_positions[i];
+        cells[mine] |= Cell::MINE_BIT;
+        // Adjacent counts are accumulated from the mines instead of counted per cell
+        const int32_t* slots = &m_neighbours[static_cast<size_t>(mine) * 8];
+        for (int k = 0; k < 8 && slots[k] >= 0; ++k) {
+            cells[slots[k]] += 1;
+        }
+    }
+}
+
+inline int GameBatch::openCell(uint8_t* cells, int cell, int& minesHit) {
+    // Reveal one hidden, unflagged cell; zero cells are pushed for the flood fill
+    // Returns the safe cells revealed
+    if ((cells[cell] & Cell::STATE_MASK) != 0) {
+        return 0;
+    }
+    cells[cell] |= Cell::REVEALED << Cell::STATE_SHIFT;
+    if (cells[cell] & Cell::MINE_BIT) {
+        minesHit += 1;
+        return 0;
+    }
+    if ((cells[cell] & Cell::ADJACENT_MASK) == 0) {
+        m_stack.push_back(cell);
+    }
+    return 1;
+}
+
+inline int GameBatch::floodFill(uint8_t* cells) {
+    // Depth-first variant of Board::floodFill; reveals the same set of cells
+    int revealed = 0;
+    int unused = 0;
+    while (!m_stack.empty()) {
+        const int cell = m_stack.back();
+        m_stack.pop_back();
+        const int32_t* slots = &m_neighbours[static_cast<size_t>(cell) * 8];
+        for (int k = 0; k < 8 && slots[k] >= 0; ++k) {
+            if (!(cells[slots[k]] & Cell::MINE_BIT)) {
+                revealed += openCell(cells, slots[k], unused);
+            }
+        }
+    }
+    return revealed;
+}
+
+inline int GameBatch::chord(uint8_t* cells, int cell, int& minesHit) {
+    // Same rule as Board::chordCell
+    const uint8_t center = cells[cell];
+    const int number = center & Cell::ADJACENT_MASK;
+    if ((center & Cell::STATE_MASK) != (Cell::REVEALED << Cell::STATE_SHIFT) || (center & Cell::MINE_BIT) || number == 0) {
+        return 0;
+    }
+    const int32_t* slots = &m_neighbours[static_cast<size_t>(cell) * 8];
+    int flagged = 0;
+    for (int k = 0; k < 8 && slots[k] >= 0; ++k) {
+        flagged += (cells[slots[k]] & Cell::STATE_MASK) == (Cell::FLAGGED << Cell::STATE_SHIFT);
+    }
+    if (flagged != number) {
+        return 0;
+    }
+    int revealed = 0;
+    for (int k = 0; k < 8 && slots[k] >= 0; ++k) {
+        revealed += openCell(cells, slots[k], minesHit);
+    }
+    return revealed + floodFill(cells);
+}
+
+inline void GameBatch::step(std::span<const Action> actions) {
+    const int safeCells = m_cellCount - m_mines;
+    const int games = std::min(m_count, static_cast<int>(actions.size()));
+    int gamesStarted = 0, gamesWon = 0, gamesLost = 0;
+    // Games without an action this step report no reward and are not done
+    std::fill(m_rewards.begin(), m_rewards.end(), 0.0f);
+    std::fill(m_done.begin(), m_done.end(), uint8_t{0});
+    std::fill(m_won.begin(), m_won.end(), uint8_t{0});
+    for (int game = 0; game < games; ++game) {
+        uint8_t* cells = m_cells.data() + static_cast<size_t>(game) * m_cellCount;
+        const Action& action = actions[game];
+        if (action.cell < 0 || action.cell >= m_cellCount) {
+            continue;
+        }
+
+        int revealed = 0;
+        int minesHit = 0;
+        switch (action.type) {
+            case REVEAL:
+                // As in Game, only a reveal that opens a cell places the mines
+                if (!m_initialized[game] && (cells[action.cell] & Cell::STATE_MASK) == 0) {
+                    placeMines(game, action.cell);
+                    m_initialized[game] = 1;
+                    gamesStarted += 1;
+                }
+                revealed = openCell(cells, action.cell, minesHit);
+                revealed += floodFill(cells);
+                break;
+            case FLAG:
+                // Toggle between hidden and flagged; revealed cells are left alone
+                if ((cells[action.cell] & Cell::STATE_MASK) != (Cell::REVEALED << Cell::STATE_SHIFT)) {
+                    cells[action.cell] ^= Cell::FLAGGED << Cell::STATE_SHIFT;
+                }
+                break;
+            case CHORD:
+                revealed = chord(cells, action.cell, minesHit);
+                break;
+            default:
+                break;
+        }
+
+        m_safeRevealed[game] += revealed;
+        m_lives[game] = std::max(0, m_lives[game] - minesHit);
+        m_rewards[game] = static_cast<float>(revealed) / static_cast<float>(safeCells) - static_cast<float>(minesHit);
+        if (m_lives[game] == 0) {
+            m_done[game] = 1;
+            gamesLost += 1;
+        } else if (m_safeRevealed[game] == safeCells) {
+            m_rewards[game] = 1.0f;
+            m_done[game] = 1;
+            m_won[game] = 1;
+            gamesWon += 1;
+        }
+        if (m_done[game]) {
+            reset(game);
+        }
+    }
+    Metrics::add(Metrics::GAMES_STARTED, gamesStarted);
+    Metrics::add(Metrics::MOVES, games);
+    Metrics::add(Metrics::GAMES_WON, gamesWon);
+    Metrics::add(Metrics::GAMES_LOST, gamesLost);
+}
+
+inline int GameBatch::getCount() const {
+    return m_count;
+}
+
+inline int GameBatch::getWidth() const {
+    return m_width;
+}
+
+inline int GameBatch::getHeight() const {
+    return m_height;
+}
+
+inline int GameBatch::getLives(int game) const {
+    return m_lives[game];
+}
+
+inline int GameBatch::getRevealedCount(int game) const {
+    return m_safeRevealed[game];
+}
+
+inline std::span<const float> GameBatch::rewards() const {
+    return m_rewards;
+}
+
+inline std::span<const uint8_t> GameBatch::done() const {
+    return m_done;
+}
+
+inline std::span<const uint8_t> GameBatch::won() const {
+    return m_won;
+}
+
+inline bool GameBatch::observe(std::span<uint8_t> out) const {
+    if (out.size() < m_cells.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < m_cells.size(); ++i) {
+        out[i] = Cell::visibleCode(m_cells[i]);
+    }
+    return true;
+}
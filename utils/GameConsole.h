@@ -1,4 +1,6 @@
 #include "Game.h"
+#include "TerminalRenderer.h"
+#include "BoardGenerator.h"
 #include <bits/stdc++.h>
 using namespace std;
 
@@ -6,11 +8,118 @@ using namespace std;
 class GameConsole {
 public:
     void clearScreen() {
-        #ifdef _WIN32
-                system("cls");
-        #else
-                system("clear");
-        #endif
+        // The next frame is drawn from scratch (ANSI clear plus full board)
+        m_renderer.invalidate();
+    }
+
+    void renderFrame(const Game& game) {
+        // Board changes since the last frame, then the status area below it
+        if (game.getBoard()) {
+            clampViewport(*game.getBoard());
+            m_renderer.present(*game.getBoard(), m_viewX, m_viewY, m_viewRows, m_viewCols, std::cout,
+                               m_deltaValid ? &m_delta : nullptr);
+        }
+        game.displayGameInfo();
+        if (game.getBoard() &&
+            (m_viewRows < game.getBoard()->getHeight() || m_viewCols < game.getBoard()->getWidth())) {
+            const int lastRow = std::min(game.getBoard()->getHeight(), m_viewX + m_viewRows) - 1;
+            const int lastCol = std::min(game.getBoard()->getWidth(), m_viewY + m_viewCols) - 1;
+            std::cout << "View: rows " << m_viewX << "-" << lastRow
+                      << ", cols " << m_viewY << "-" << lastCol << '\n';
+        }
+        std::cout << m_messages;
+        // Long output scrolls the board away, so redraw it fully next time
+        if (std::count(m_messages.begin(), m_messages.end(), '\n') > MAX_STATUS_LINES) {
+            m_renderer.invalidate();
+        }
+        m_messages.clear();
+    }
+
+    void clampViewport(const Board& board) {
+        // Keep the viewport origin inside the board
+        m_viewX = std::clamp(m_viewX, 0, std::max(0, board.getHeight() - m_viewRows));
+        m_viewY = std::clamp(m_viewY, 0, std::max(0, board.getWidth() - m_viewCols));
+    }
+
+    void scrollToShow(const Board& board, int x, int y) {
+        // Scroll just enough for (x, y) to be inside the viewport
+        if (x < m_viewX) {
+            m_viewX = x;
+        } else if (x >= m_viewX + m_viewRows) {
+            m_viewX = x - m_viewRows + 1;
+        }
+        if (y < m_viewY) {
+            m_viewY = y;
+        } else if (y >= m_viewY + m_viewCols) {
+            m_viewY = y - m_viewCols + 1;
+        }
+        clampViewport(board);
+    }
+
+    static int defaultMinimapTileSize(const Board& board) {
+        // Largest side squeezed into roughly 60 columns by 20 rows
+        const int byWidth = (board.getWidth() + MINIMAP_COLS - 1) / MINIMAP_COLS;
+        const int byHeight = (board.getHeight() + MINIMAP_ROWS - 1) / MINIMAP_ROWS;
+        return std::max({1, byWidth, byHeight});
+    }
+
+    void displayMinimap(const Minimap& minimap) const {
+        // One character per tile; tiles overlapping the viewport are shown in reverse video
+        const int tileSize = minimap.getTileSize();
+        const int viewTop = m_viewX / tileSize;
+        const int viewBottom = (m_viewX + m_viewRows - 1) / tileSize;
+        const int viewLeft = m_viewY / tileSize;
+        const int viewRight = (m_viewY + m_viewCols - 1) / tileSize;
+        std::string out;
+        out.reserve(static_cast<size_t>(minimap.getTileRows()) * (minimap.getTileCols() + 16));
+        out += "Minimap (" + std::to_string(tileSize) + "x" + std::to_string(tileSize) + " tiles):\n";
+        for (int row = 0; row < minimap.getTileRows(); ++row) {
+            const bool rowInView = row >= viewTop && row <= viewBottom;
+            for (int col = 0; col < minimap.getTileCols(); ++col) {
+                const bool inView = rowInView && col >= viewLeft && col <= viewRight;
+                if (inView && col == viewLeft) {
+                    out += "\x1b[7m";
+                }
+                out += minimap.getTileChar(row, col);
+                if (inView && col == viewRight) {
+                    out += "\x1b[0m";
+                }
+            }
+            out += '\n';
+        }
+        out += "Legend: # untouched, 0-9 tens of percent revealed, . done, F only flags left, * exploded\n";
+        std::cout << out;
+    }
+
+    static void reportMinesHit(const Game& game) {
+        // The hit of the move just made, while the game goes on; a lost game has its own banner
+        const int count = game.getLastMinesHit();
+        if (count > 0 && game.hasLivesRemaining()) {
+            std::cout << "BOOM! You hit " << (count == 1 ? "a mine" : std::to_string(count) + " mines")
+                      << ". Lives left: " << game.getLives() << std::endl;
+        }
+    }
+
+    bool runCommand(Game& game, const std::string& input) {
+        // Capture the command's output so it is shown under the next frame
+        // Only moves report their changed cells; anything else rescans the viewport
+        m_deltaValid = false;
+        std::ostringstream captured;
+        std::streambuf* original = std::cout.rdbuf(captured.rdbuf());
+        bool keepRunning;
+        try {
+            keepRunning = processCommand(game, input);
+        } catch (...) {
+            std::cout.rdbuf(original);
+            throw;
+        }
+        std::cout.rdbuf(original);
+        m_messages = captured.str();
+        if (!keepRunning) {
+            std::cout << m_messages;
+            m_messages.clear();
+        }
+        return keepRunning;
     }
 
     void displayWelcome() {
@@ -88,7 +197,7 @@ public:
         std::cout << "╚════════════════════════════════════════════════╝" << std::endl;
     }
 
-    bool processCommand(Game game, const std::string& input) {
+    bool processCommand(Game& game, const std::string& input) {
         std::istringstream iss(input);
         std::string command;
         iss >> command;
@@ -103,6 +212,11 @@ public:
             case 'h':
             case 'H':
                 game.displayHelp();
+                std::cout << "Viewport (large boards):\n"
+                          << "  v <rows> <cols>  Set the viewport size\n"
+                          << "  p <rows> <cols>  Pan the viewport by rows/columns (negative to go back)\n"
+                          << "  j <x> <y>        Center the viewport on a cell\n"
+                          << "  m [tile]         Show the minimap (tiles under the viewport are highlighted)\n";
                 break;
 
             case 'q':
@@ -123,6 +237,107 @@ public:
                 }
                 break;
 
+            case 'v':
+            case 'V': {
+                // Resize the viewport
+                int rows, cols;
+                if (iss >> rows >> cols && rows > 0 && cols > 0) {
+                    m_viewRows = rows;
+                    m_viewCols = cols;
+                    clampViewport(*game.getBoard());
+                } else {
+                    std::cout << "Invalid command format. Use: v <rows> <cols>" << std::endl;
+                }
+                break;
+            }
+
+            case 'p':
+            case 'P': {
+                // Pan the viewport by a number of rows and columns
+                int dx, dy;
+                if (iss >> dx >> dy) {
+                    m_viewX += dx;
+                    m_viewY += dy;
+                    clampViewport(*game.getBoard());
+                } else {
+                    std::cout << "Invalid command format. Use: p <rows> <cols>" << std::endl;
+                }
+                break;
+            }
+
+            case 'j':
+            case 'J': {
+                // Center the viewport on a cell
+                int x, y;
+                if (iss >> x >> y && game.getBoard()->isValidPosition(x, y)) {
+                    m_viewX = x - m_viewRows / 2;
+                    m_viewY = y - m_viewCols / 2;
+                    clampViewport(*game.getBoard());
+                } else {
+                    std::cout << "Invalid command format. Use: j <x> <y> inside the board" << std::endl;
+                }
+                break;
+            }
+
+            case 'm':
+            case 'M': {
+                // Show the minimap, enabling it on first use
+                Board& board = *game.getBoard();
+                int tileSize;
+                if (!(iss >> tileSize) || tileSize <= 0) {
+                    tileSize = board.getMinimap() ? board.getMinimap()->getTileSize()
+                                                  : defaultMinimapTileSize(board);
+                }
+                if (!board.getMinimap() || board.getMinimap()->getTileSize() != tileSize) {
+                    board.enableMinimap(tileSize);
+                }
+                displayMinimap(*board.getMinimap());
+                break;
+            }
+
+            case 'g':
+            case 'G': {
+                // New game on a layout whose 3BV lies in the requested band
+                int minBbbv, maxBbbv;
+                if (!(iss >> minBbbv >> maxBbbv) || minBbbv > maxBbbv) {
+                    std::cout << "Invalid command format. Use: g <min 3BV> <max 3BV>" << std::endl;
+                    break;
+                }
+                int width, height, mines;
+                game.getDifficultySettings(width, height, mines);
+                const BoardGenerator::Target target{BoardGenerator::BBBV, minBbbv, maxBbbv};
+                std::unique_ptr<Board> board = BoardGenerator::generate(
+                    width, height, mines, height / 2, width / 2, target, std::random_device{}());
+                if (!board) {
+                    std::cout << "No layout with 3BV in [" << minBbbv << ", " << maxBbbv << "] found." << std::endl;
+                    break;
+                }
+                game.loadBoard(std::move(board));
+                std::cout << "New game started! Cell " << height / 2 << " " << width / 2 << " is safe." << std::endl;
+                break;
+            }
+
+            case 'b':
+            case 'B': {
+                // Bulk reveal or flag of a rectangle, applied as a single move
+                char action;
+                int x0, y0, x1, y1;
+                if (iss >> action >> x0 >> y0 >> x1 >> y1 &&
+                    (action == 'r' || action == 'R' || action == 'f' || action == 'F')) {
+                    scrollToShow(*game.getBoard(), std::clamp(x1, 0, game.getBoard()->getHeight() - 1),
+                                 std::clamp(y1, 0, game.getBoard()->getWidth() - 1));
+                    if (action == 'r' || action == 'R') {
+                        std::cout << game.revealRect(x0, y0, x1, y1) << " cells revealed." << std::endl;
+                        reportMinesHit(game);
+                    } else {
+                        std::cout << game.flagRect(x0, y0, x1, y1) << " cells flagged." << std::endl;
+                    }
+                } else {
+                    std::cout << "Invalid command format. Use: b r|f <x0> <y0> <x1> <y1>" << std::endl;
+                }
+                break;
+            }
+
             case 'l':
             case 'L': {
                 // New command to set lives
@@ -139,18 +354,26 @@ public:
             case 'r':
             case 'R':
             case 'f':
-            case 'F': {
+            case 'F':
+            case 'c':
+            case 'C': {
                 int x, y;
                 if (iss >> x >> y) {
 
                     if (game.getBoard()->isValidPosition(x, y)) {
-                        bool success = game.makeMove(x, y, cmd);
+                        scrollToShow(*game.getBoard(), x, y);
+                        bool success = game.makeMove(x, y, cmd, m_delta);
+                        m_deltaValid = true;
+                        reportMinesHit(game);
                         if (!success && (cmd == 'r' || cmd == 'R')) {
                             if (game.getBoard()->getCell(x, y).isFlagged()) {
                                 std::cout << "Cannot reveal a flagged cell. Remove flag first." << std::endl;
                             } else if (game.getBoard()->getCell(x, y).isRevealed()) {
                                 std::cout << "Cell already revealed." << std::endl;
                             }
+                        } else if (!success && (cmd == 'c' || cmd == 'C') && !game.isGameOver()) {
+                            std::cout << "Nothing to chord: pick a revealed number with exactly that many flags around it."
+                                      << std::endl;
                         }
                     } else {
                         std::cout << "Invalid coordinates. Please check the board dimensions." << std::endl;
@@ -170,5 +393,22 @@ public:
     }
 
     GameConsole() = default;
+
+private:
+    static constexpr int MAX_STATUS_LINES = 8;
+    static constexpr int DEFAULT_VIEW_ROWS = 20;
+    static constexpr int DEFAULT_VIEW_COLS = 30;
+    static constexpr int MINIMAP_ROWS = 20;
+    static constexpr int MINIMAP_COLS = 60;
+
+    int m_viewX = 0;
+    int m_viewY = 0;
+    int m_viewRows = DEFAULT_VIEW_ROWS;
+    int m_viewCols = DEFAULT_VIEW_COLS;
+
+    TerminalRenderer m_renderer;
+    BoardDelta m_delta;
+    bool m_deltaValid = false;
+    std::string m_messages;
 };
 
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// Process wide game metrics.
+// Every thread owns its own cache-line aligned slot and is the only writer of it,
+// so recording a value is a plain relaxed load/store with no shared cache lines.
+// Slots are only read (and summed) when the metrics are flushed.
+class Metrics {
+public:
+    enum Counter
+    {
+        GAMES_STARTED,
+        GAMES_WON,
+        GAMES_LOST,
+        LIVES_CONSUMED,
+        MOVES,
+        FLOOD_FILL_CELLS,
+        BOARDS_GENERATED,
+        COUNTER_COUNT
+    };
+
+    enum Latency
+    {
+        MOVE_LATENCY,
+        GENERATION_LATENCY,
+        LATENCY_COUNT
+    };
+
+    // Latencies are bucketed by power of two nanoseconds (bucket i holds [2^i, 2^(i+1)))
+    static constexpr int LATENCY_BUCKETS = 40;
+
+    struct Snapshot {
+        std::array<uint64_t, COUNTER_COUNT> counters{};
+        std::array<uint64_t, LATENCY_COUNT> latencyCount{};
+        std::array<uint64_t, LATENCY_COUNT> latencySumNs{};
+        std::array<std::array<uint64_t, LATENCY_BUCKETS>, LATENCY_COUNT> latencyBuckets{};
+    };
+
+    static void add(Counter counter, uint64_t amount = 1);
+    static void observe(Latency latency, std::chrono::nanoseconds elapsed);
+    static Snapshot snapshot();
+    static std::string formatPrometheus(const Snapshot& current, const Snapshot& previous, double intervalSeconds);
+    static bool writePrometheus(const std::string& path, const std::string& text);
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> counters[COUNTER_COUNT] = {};
+        std::atomic<uint64_t> latencyCount[LATENCY_COUNT] = {};
+        std::atomic<uint64_t> latencySumNs[LATENCY_COUNT] = {};
+        std::atomic<uint64_t> latencyBuckets[LATENCY_COUNT][LATENCY_BUCKETS] = {};
+    };
+
+    static Slot& localSlot();
+    static std::mutex& registryMutex();
+    static std::deque<Slot>& registry();
+    static void bump(std::atomic<uint64_t>& value, uint64_t amount);
+    static double quantileSeconds(const std::array<uint64_t, LATENCY_BUCKETS>& buckets, uint64_t count, double q);
+};
+
+// Periodically flushes the aggregated metrics to a Prometheus textfile.
+// The file is written next to its final path and renamed into place so a
+// node-exporter textfile collector never reads a partial file.
+class MetricsDumper {
+public:
+    MetricsDumper(std::string path, std::chrono::milliseconds interval);
+    ~MetricsDumper();
+    void flush();
+
+private:
+    void run();
+
+    std::string m_path;
+    std::chrono::milliseconds m_interval;
+    Metrics::Snapshot m_previous;
+    std::chrono::steady_clock::time_point m_previousTime;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_stopping;
+    std::thread m_thread;
+};
+
+inline std::mutex& Metrics::registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+inline std::deque<Metrics::Slot>& Metrics::registry() {
+    // Slots are never released, so counts of finished threads survive until the next flush
+    static std::deque<Slot> slots;
+    return slots;
+}
+
+inline Metrics::Slot& Metrics::localSlot() {
+    thread_local Slot* slot = nullptr;
+    if (slot == nullptr) {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        slot = &registry().emplace_back();
+    }
+    return *slot;
+}
+
+inline void Metrics::bump(std::atomic<uint64_t>& value, uint64_t amount) {
+    // Single writer per slot: no read-modify-write instruction is needed
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+inline void Metrics::add(Counter counter, uint64_t amount) {
+    bump(localSlot().counters[counter], amount);
+}
+
+inline void Metrics::observe(Latency latency, std::chrono::nanoseconds elapsed) {
+    Slot& slot = localSlot();
+    const uint64_t ns = elapsed.count() > 0 ? static_cast<uint64_t>(elapsed.count()) : 0;
+    const int bucket = std::min(LATENCY_BUCKETS - 1, static_cast<int>(std::bit_width(ns)) - 1);
+    bump(slot.latencyCount[latency], 1);
+    bump(slot.latencySumNs[latency], ns);
+    bump(slot.latencyBuckets[latency][std::max(bucket, 0)], 1);
+}
+
+inline Metrics::Snapshot Metrics::snapshot() {
+    // Sum every thread's slot; writers are never blocked by this
+    Snapshot total;
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (const Slot& slot : registry()) {
+        for (int i = 0; i < COUNTER_COUNT; ++i)
+            total.counters[i] += slot.counters[i].load(std::memory_order_relaxed);
+        for (int i = 0; i < LATENCY_COUNT; ++i) {
+            total.latencyCount[i] += slot.latencyCount[i].load(std::memory_order_relaxed);
+            total.latencySumNs[i] += slot.latencySumNs[i].load(std::memory_order_relaxed);
+            for (int b = 0; b < LATENCY_BUCKETS; ++b)
+                total.latencyBuckets[i][b] += slot.latencyBuckets[i][b].load(std::memory_order_relaxed);
+        }
+    }
+    return total;
+}
+
+inline double Metrics::quantileSeconds(const std::array<uint64_t, LATENCY_BUCKETS>& buckets, uint64_t count, double q) {
+    // Report the upper bound of the bucket holding the requested rank
+    if (count == 0)
+        return 0.0;
+    const uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(count)));
+    uint64_t seen = 0;
+    for (int b = 0; b < LATENCY_BUCKETS; ++b) {
+        seen += buckets[b];
+        if (seen >= rank)
+            return std::ldexp(1.0, b + 1) * 1e-9;
+    }
+    return std::ldexp(1.0, LATENCY_BUCKETS) * 1e-9;
+}
+
+inline std::string Metrics::formatPrometheus(const Snapshot& current, const Snapshot& previous, double intervalSeconds) {
+    static const char* counterNames[COUNTER_COUNT] = {
+        "minesweeper_games_started_total",
+        "minesweeper_games_won_total",
+        "minesweeper_games_lost_total",
+        "minesweeper_lives_consumed_total",
+        "minesweeper_moves_total",
+        "minesweeper_flood_fill_cells_total",
+        "minesweeper_boards_generated_total",
+    };
+    static const char* latencyNames[LATENCY_COUNT] = {
+        "minesweeper_move_latency_seconds",
+        "minesweeper_board_generation_latency_seconds",
+    };
+
+    std::ostringstream out;
+    for (int i = 0; i < COUNTER_COUNT; ++i) {
+        out << "# TYPE " << counterNames[i] << " counter\n";
+        out << counterNames[i] << " " << current.counters[i] << "\n";
+    }
+
+    // Throughput since the previous flush
+    const auto rate = [&](Counter counter) {
+        if (intervalSeconds <= 0.0)
+            return 0.0;
+        return static_cast<double>(current.counters[counter] - previous.counters[counter]) / intervalSeconds;
+    };
+    out << "# TYPE minesweeper_moves_per_second gauge\n";
+    out << "minesweeper_moves_per_second " << rate(MOVES) << "\n";
+    out << "# TYPE minesweeper_flood_fill_cells_per_second gauge\n";
+    out << "minesweeper_flood_fill_cells_per_second " << rate(FLOOD_FILL_CELLS) << "\n";
+    out << "# TYPE minesweeper_boards_generated_per_second gauge\n";
+    out << "minesweeper_boards_generated_per_second " << rate(BOARDS_GENERATED) << "\n";
+
+    for (int i = 0; i < LATENCY_COUNT; ++i) {
+        out << "# TYPE " << latencyNames[i] << " summary\n";
+        for (const double q : {0.5, 0.9, 0.99}) {
+            out << latencyNames[i] << "{quantile=\"" << q << "\"} "
+                << quantileSeconds(current.latencyBuckets[i], current.latencyCount[i], q) << "\n";
+        }
+        out << latencyNames[i] << "_sum " << static_cast<double>(current.latencySumNs[i]) * 1e-9 << "\n";
+        out << latencyNames[i] << "_count " << current.latencyCount[i] << "\n";
+    }
+    return out.str();
+}
+
+inline bool Metrics::writePrometheus(const std::string& path, const std::string& text) {
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        if (!file)
+            return false;
+        file << text;
+        if (!file.flush())
+            return false;
+    }
+    return std::rename(tmpPath.c_str(), path.c_str()) == 0;
+}
+
+inline MetricsDumper::MetricsDumper(std::string path, std::chrono::milliseconds interval)
+    : m_path(std::move(path))
+    , m_interval(interval)
+    , m_previous(Metrics::snapshot())
+    , m_previousTime(std::chrono::steady_clock::now())
+    , m_stopping(false)
+{
+    m_thread = std::thread(&MetricsDumper::run, this);
+}
+
+inline MetricsDumper::~MetricsDumper() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeup.notify_all();
+    m_thread.join();
+    flush();
+}
+
+inline void MetricsDumper::flush() {
+    const Metrics::Snapshot current = Metrics::snapshot();
+    const auto now = std::chrono::steady_clock::now();
+    const double interval = std::chrono::duration<double>(now - m_previousTime).count();
+    Metrics::writePrometheus(m_path, Metrics::formatPrometheus(current, m_previous, interval));
+    m_previous = current;
+    m_previousTime = now;
+}
+
+inline void MetricsDumper::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping) {
+        if (!m_wakeup.wait_for(lock, m_interval, [this] { return m_stopping; }))
+            flush();
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// Downsampled overview of a large board.
+// The board is split into tileSize x tileSize tiles and every tile keeps counts of
+// its hidden, revealed, flagged and exploded (revealed mine) cells. The counts are
+// updated from each cell change the board reports, never by rescanning the board.
+class Minimap {
+public:
+    struct Tile {
+        int hidden;
+        int revealed;
+        int flagged;
+        int exploded;
+    };
+
+    Minimap(int width, int height, int tileSize);
+
+    void reset();
+    void onReveal(int x, int y, bool mine);
+    void onFlag(int x, int y, bool flagged);
+
+    int getTileSize() const;
+    int getTileRows() const;
+    int getTileCols() const;
+    const Tile& getTile(int row, int col) const;
+    char getTileChar(int row, int col) const;
+
+private:
+    Tile& tileAt(int x, int y);
+
+    int m_width;
+    int m_height;
+    int m_tileSize;
+    int m_tileRows;
+    int m_tileCols;
+    vector<Tile> m_tiles;
+};
+
+inline Minimap::Minimap(int width, int height, int tileSize)
+    : m_width(width)
+    , m_height(height)
+    , m_tileSize(std::max(1, tileSize))
+    , m_tileRows((height + m_tileSize - 1) / m_tileSize)
+    , m_tileCols((width + m_tileSize - 1) / m_tileSize)
+    , m_tiles(static_cast<size_t>(m_tileRows) * m_tileCols)
+{
+    reset();
+}
+
+inline void Minimap::reset() {
+    // Every cell starts hidden; edge tiles may be smaller than tileSize
+    for (int row = 0; row < m_tileRows; ++row)
+    {
+        const int rows = std::min(m_tileSize, m_height - row * m_tileSize);
+        for (int col = 0; col < m_tileCols; ++col)
+        {
+            const int cols = std::min(m_tileSize, m_width - col * m_tileSize);
+            m_tiles[static_cast<size_t>(row) * m_tileCols + col] = Tile{rows * cols, 0, 0, 0};
+        }
+    }
+}
+
+inline Minimap::Tile& Minimap::tileAt(int x, int y) {
+    return m_tiles[static_cast<size_t>(x / m_tileSize) * m_tileCols + y / m_tileSize];
+}
+
+inline void Minimap::onReveal(int x, int y, bool mine) {
+    Tile& tile = tileAt(x, y);
+    tile.hidden -= 1;
+    if (mine)
+        tile.exploded += 1;
+    else
+        tile.revealed += 1;
+}
+
+inline void Minimap::onFlag(int x, int y, bool flagged) {
+    Tile& tile = tileAt(x, y);
+    tile.hidden += flagged ? -1 : 1;
+    tile.flagged += flagged ? 1 : -1;
+}
+
+inline int Minimap::getTileSize() const {
+    return m_tileSize;
+}
+
+inline int Minimap::getTileRows() const {
+    return m_tileRows;
+}
+
+inline int Minimap::getTileCols() const {
+    return m_tileCols;
+}
+
+inline const Minimap::Tile& Minimap::getTile(int row, int col) const {
+    return m_tiles[static_cast<size_t>(row) * m_tileCols + col];
+}
+
+inline char Minimap::getTileChar(int row, int col) const {
+    // '*' tile with an exploded mine
+    // '#' untouched tile, '.' nothing left hidden, 'F' only flags left
+    // '0'-'9' tens of percent revealed for partly opened tiles
+    const Tile& tile = getTile(row, col);
+    const int total = tile.hidden + tile.revealed + tile.flagged + tile.exploded;
+    if (tile.exploded > 0)
+        return '*';
+    if (tile.hidden == total)
+        return '#';
+    if (tile.hidden == 0)
+        return tile.flagged > 0 ? 'F' : '.';
+    return static_cast<char>('0' + std::min(9, tile.revealed * 10 / total));
+}
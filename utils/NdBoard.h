@@ -0,0 +1,200 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Board.h"
+using namespace std;
+
+// Minesweeper board with D axes (3D boards have 26 neighbours, 4D ones 80).
+// A BasicBoard with NdLayout and NdTopology: the last coordinate of a Point is
+// the board column and the others make up the board row, so placement,
+// adjacency, openings, fills, chords and the win check are Board's own and this
+// class only translates Points.
+// Cells are exposed by state, mine and exact adjacent count, since a Cell
+// cannot hold the counts of three axes and more.
+template <int D>
+class NdBoard {
+public:
+    using Point = std::array<int, D>;
+    using Grid = BasicBoard<NdLayout<D>, NdTopology<D>>;
+
+    static constexpr int NEIGHBOURS = NdTopology<D>::DEGREE;
+
+    // Throws std::invalid_argument for an empty extent, a mine count that leaves
+    // no safe cell or a board whose cells cannot be indexed with 32 bits
+    NdBoard(const Point& extents, int mineCount);
+    // Same with a fixed seed for the mine placement, for reproducible layouts
+    NdBoard(const Point& extents, int mineCount, uint64_t seed);
+
+    bool revealCell(const Point& p);
+    bool toggleFlag(const Point& p);
+    bool chordCell(const Point& p, int& minesHit);
+    void initializeMines(const Point& firstClick);
+    void reset();
+    bool isGameWon() const;
+    bool isGameLost() const;
+    bool isMineAt(const Point& p) const;
+    bool isValidPosition(const Point& p) const;
+    Cell::State getState(const Point& p) const;
+    int getAdjacentMines(const Point& p) const;
+    const Point& getExtents() const;
+    long long getCellCount() const;
+    int getMineCount() const;
+    int getFlagCount() const;
+    int getRevealedCount() const;
+    int getRevealedMineCount() const;
+
+private:
+    static const Point& checked(const Point& extents, int mineCount);
+    static int rowCount(const Point& extents);
+    int rowOf(const Point& p) const;
+
+    Point m_extents;
+    Grid m_grid;
+};
+
+template <int D>
+inline NdBoard<D>::NdBoard(const Point& extents, int mineCount)
+    : NdBoard(extents, mineCount, std::random_device{}())
+{
+}
+
+template <int D>
+inline NdBoard<D>::NdBoard(const Point& extents, int mineCount, uint64_t seed)
+    : m_extents(checked(extents, mineCount))
+    , m_grid(extents[D - 1], rowCount(extents), mineCount, seed, NdLayout<D>(extents), NdTopology<D>(extents))
+{
+}
+
+template <int D>
+inline const typename NdBoard<D>::Point& NdBoard<D>::checked(const Point& extents, int mineCount) {
+    // Board takes its arguments as given, so they are checked before it is built
+    long long cells = 1;
+    for (int k = 0; k < D; ++k)
+    {
+        if (extents[k] <= 0)
+            throw std::invalid_argument("NdBoard: every extent must be positive");
+        cells *= extents[k];
+        if (cells > std::numeric_limits<int32_t>::max())
+            throw std::invalid_argument("NdBoard: too many cells");
+    }
+    // The layout pads every axis with a border cell on both sides
+    long long padded = D == 1 ? 3 : 1;
+    for (int k = 0; k < D; ++k)
+    {
+        padded *= extents[k] + 2LL;
+        if (padded > std::numeric_limits<int32_t>::max())
+            throw std::invalid_argument("NdBoard: too many cells");
+    }
+    if (mineCount < 0 or mineCount >= cells)
+        throw std::invalid_argument("NdBoard: the mine count must leave a safe cell");
+    return extents;
+}
+
+template <int D>
+inline int NdBoard<D>::rowCount(const Point& extents) {
+    int rows = 1;
+    for (int k = 0; k < D - 1; ++k)
+        rows *= extents[k];
+    return rows;
+}
+
+template <int D>
+inline int NdBoard<D>::rowOf(const Point& p) const {
+    // Grid row of p: its leading coordinates in mixed radix
+    int row = 0;
+    for (int k = 0; k < D - 1; ++k)
+        row = row * m_extents[k] + p[k];
+    return row;
+}
+
+template <int D>
+inline bool NdBoard<D>::isValidPosition(const Point& p) const {
+    for (int k = 0; k < D; ++k)
+    {
+        if (p[k] < 0 or p[k] >= m_extents[k])
+            return false;
+    }
+    return true;
+}
+
+template <int D>
+inline bool NdBoard<D>::revealCell(const Point& p) {
+    return isValidPosition(p) and m_grid.revealCell(rowOf(p), p[D - 1]);
+}
+
+template <int D>
+inline bool NdBoard<D>::toggleFlag(const Point& p) {
+    return isValidPosition(p) and m_grid.toggleFlag(rowOf(p), p[D - 1]);
+}
+
+template <int D>
+inline bool NdBoard<D>::chordCell(const Point& p, int& minesHit) {
+    minesHit = 0;
+    return isValidPosition(p) and m_grid.chordCell(rowOf(p), p[D - 1], minesHit);
+}
+
+template <int D>
+inline void NdBoard<D>::initializeMines(const Point& firstClick) {
+    m_grid.initializeMines(rowOf(firstClick), firstClick[D - 1]);
+}
+
+template <int D>
+inline void NdBoard<D>::reset() {
+    m_grid.reset();
+}
+
+template <int D>
+inline bool NdBoard<D>::isGameWon() const {
+    return m_grid.isGameWon();
+}
+
+template <int D>
+inline bool NdBoard<D>::isGameLost() const {
+    return m_grid.isGameLost();
+}
+
+template <int D>
+inline bool NdBoard<D>::isMineAt(const Point& p) const {
+    return isValidPosition(p) and m_grid.isMineAt(rowOf(p), p[D - 1]);
+}
+
+template <int D>
+inline Cell::State NdBoard<D>::getState(const Point& p) const {
+    return m_grid.getCell(rowOf(p), p[D - 1]).getState();
+}
+
+template <int D>
+inline int NdBoard<D>::getAdjacentMines(const Point& p) const {
+    // Exact count of a non-mine cell once the mines are placed
+    return m_grid.getAdjacentMines(rowOf(p), p[D - 1]);
+}
+
+template <int D>
+inline const typename NdBoard<D>::Point& NdBoard<D>::getExtents() const {
+    return m_extents;
+}
+
+template <int D>
+inline long long NdBoard<D>::getCellCount() const {
+    return static_cast<long long>(m_grid.getWidth()) * m_grid.getHeight();
+}
+
+template <int D>
+inline int NdBoard<D>::getMineCount() const {
+    return m_grid.getMineCount();
+}
+
+template <int D>
+inline int NdBoard<D>::getFlagCount() const {
+    return m_grid.getFlagCount();
+}
+
+template <int D>
+inline int NdBoard<D>::getRevealedCount() const {
+    return m_grid.getRevealedCount();
+}
+
+template <int D>
+inline int NdBoard<D>::getRevealedMineCount() const {
+    return m_grid.getRevealedMineCount();
+}
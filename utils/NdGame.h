@@ -0,0 +1,189 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Game.h"
+#include "NdBoard.h"
+using namespace std;
+
+// Game rules of Game on an NdBoard: the first reveal is safe, every mine opened
+// by a reveal or a chord costs a life and stays revealed, and the game is lost
+// when the lives run out and won once every safe cell is revealed.
+// Headless: moves report their outcome instead of printing it.
+template <int D>
+class NdGame {
+public:
+    using Point = typename NdBoard<D>::Point;
+
+    enum GameState
+    {
+        NOT_STARTED,
+        WON,
+        LOST,
+        IN_PROGRESS,
+    };
+
+    struct MoveResult {
+        bool success;
+        bool mineHit;
+        int livesLeft;
+    };
+
+    NdGame(const Point& extents, int mineCount);
+    // Same with a fixed seed for the mine placement
+    NdGame(const Point& extents, int mineCount, uint64_t seed);
+
+    void start();
+    void restart();
+    void setMaxLives(int maxLives);
+
+    // action is 'r' (reveal), 'f' (toggle flag) or 'c' (chord), either case
+    MoveResult makeMove(const Point& p, char action);
+
+    bool isGameOver() const;
+    GameState getState() const;
+    int getLives() const;
+    int getMaxLives() const;
+    NdBoard<D>& getBoard();
+    const NdBoard<D>& getBoard() const;
+
+private:
+    void updateGameState();
+
+    NdBoard<D> m_board;
+    GameState m_gameState;
+    int m_lives;
+    int m_maxLives;
+};
+
+template <int D>
+inline NdGame<D>::NdGame(const Point& extents, int mineCount)
+    : m_board(extents, mineCount)
+    , m_gameState(GameState::NOT_STARTED)
+    , m_lives(DEFAULT_MAX_LIVES)
+    , m_maxLives(DEFAULT_MAX_LIVES)
+{
+}
+
+template <int D>
+inline NdGame<D>::NdGame(const Point& extents, int mineCount, uint64_t seed)
+    : m_board(extents, mineCount, seed)
+    , m_gameState(GameState::NOT_STARTED)
+    , m_lives(DEFAULT_MAX_LIVES)
+    , m_maxLives(DEFAULT_MAX_LIVES)
+{
+}
+
+template <int D>
+inline void NdGame<D>::start() {
+    m_gameState = GameState::IN_PROGRESS;
+    Metrics::add(Metrics::GAMES_STARTED);
+}
+
+template <int D>
+inline void NdGame<D>::restart() {
+    // Same board size and mine count, new layout on the next first reveal
+    m_board.reset();
+    m_gameState = GameState::NOT_STARTED;
+    m_lives = m_maxLives;
+}
+
+template <int D>
+inline void NdGame<D>::setMaxLives(int maxLives) {
+    if (maxLives > 0)
+    {
+        m_maxLives = maxLives;
+        m_lives = m_maxLives;
+    }
+}
+
+template <int D>
+inline typename NdGame<D>::MoveResult NdGame<D>::makeMove(const Point& p, char action) {
+    // Same flow as Game::makeMove(): start on the first move, refuse once over,
+    // charge one life per mine opened, then re-evaluate the game state
+    MoveResult result{false, false, m_lives};
+    if (m_gameState == GameState::NOT_STARTED)
+        start();
+    if (isGameOver())
+        return result;
+
+    const auto begin = std::chrono::steady_clock::now();
+    int minesHit = 0;
+    switch (action)
+    {
+        case 'r':
+        case 'R': {
+            // Only a cell hidden before this move can cost a life
+            const bool wasHidden = m_board.isValidPosition(p) && m_board.getState(p) != Cell::REVEALED;
+            result.success = m_board.revealCell(p);
+            if (!result.success && wasHidden && m_board.getState(p) == Cell::REVEALED && m_board.isMineAt(p))
+                minesHit = 1;
+            break;
+        }
+        case 'f':
+        case 'F':
+            result.success = m_board.toggleFlag(p);
+            break;
+        case 'c':
+        case 'C':
+            result.success = m_board.chordCell(p, minesHit);
+            break;
+        default:
+            break;
+    }
+
+    for (int i = 0; i < minesHit && m_lives > 0; ++i)
+    {
+        m_lives--;
+        Metrics::add(Metrics::LIVES_CONSUMED);
+    }
+    if (m_lives == 0)
+    {
+        m_gameState = GameState::LOST;
+        Metrics::add(Metrics::GAMES_LOST);
+    }
+    updateGameState();
+    result.mineHit = minesHit > 0;
+    result.livesLeft = m_lives;
+    Metrics::add(Metrics::MOVES);
+    Metrics::observe(Metrics::MOVE_LATENCY, std::chrono::steady_clock::now() - begin);
+    return result;
+}
+
+template <int D>
+inline void NdGame<D>::updateGameState() {
+    if (m_gameState == GameState::IN_PROGRESS && m_board.isGameWon())
+    {
+        m_gameState = GameState::WON;
+        Metrics::add(Metrics::GAMES_WON);
+    }
+}
+
+template <int D>
+inline bool NdGame<D>::isGameOver() const {
+    return m_gameState == WON or m_gameState == LOST;
+}
+
+template <int D>
+inline typename NdGame<D>::GameState NdGame<D>::getState() const {
+    return m_gameState;
+}
+
+template <int D>
+inline int NdGame<D>::getLives() const {
+    return m_lives;
+}
+
+template <int D>
+inline int NdGame<D>::getMaxLives() const {
+    return m_maxLives;
+}
+
+template <int D>
+inline NdBoard<D>& NdGame<D>::getBoard() {
+    return m_board;
+}
+
+template <int D>
+inline const NdBoard<D>& NdGame<D>::getBoard() const {
+    return m_board;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Board.h"
+using namespace std;
+
+// Dense uint8 observation planes for learning agents.
+// Layout is [plane][row][column], one byte per cell and plane, written in place
+// into a caller preallocated buffer of size(width, height) bytes:
+//   HIDDEN_PLANE    cell is not revealed and not flagged
+//   FLAG_PLANE      cell is flagged
+//   NUMBER_PLANE+k  cell is revealed with k adjacent mines (one-hot, k = 0..8)
+//   BOUNDARY_PLANE  cell is unrevealed and touches a revealed cell (the frontier)
+// A revealed mine is zero in every plane.
+class ObservationPlanes {
+public:
+    enum Plane
+    {
+        HIDDEN_PLANE = 0,
+        FLAG_PLANE = 1,
+        NUMBER_PLANE = 2,
+        BOUNDARY_PLANE = NUMBER_PLANE + 9,
+        PLANE_COUNT
+    };
+
+    static size_t size(int width, int height);
+
+    // Rebuild every plane from the board
+    static bool write(const Board& board, std::span<uint8_t> out);
+
+    // Bring planes written earlier up to date with the cells listed in delta,
+    // e.g. the delta returned by Game::makeMove()
+    static bool update(const Board& board, const BoardDelta& delta, std::span<uint8_t> out);
+
+private:
+    static void writeCell(const Board& board, int x, int y, std::span<uint8_t> out);
+    static void markBoundaryAround(const Board& board, int x, int y, std::span<uint8_t> out);
+};
+
+inline size_t ObservationPlanes::size(int width, int height) {
+    return static_cast<size_t>(PLANE_COUNT) * width * height;
+}
+
+inline void ObservationPlanes::writeCell(const Board& board, int x, int y, std::span<uint8_t> out) {
+    // Per-cell planes; the boundary plane is handled separately since it depends on neighbours
+    const size_t planeSize = static_cast<size_t>(board.getWidth()) * board.getHeight();
+    const size_t index = static_cast<size_t>(x) * board.getWidth() + y;
+    const uint8_t code = Cell::visibleCode(board.getCell(x, y).getPacked());
+    out[HIDDEN_PLANE * planeSize + index] = code == Cell::CODE_HIDDEN;
+    out[FLAG_PLANE * planeSize + index] = code == Cell::CODE_FLAG;
+    for (int k = 0; k <= 8; ++k) {
+        out[(NUMBER_PLANE + k) * planeSize + index] = code == k;
+    }
+    if (board.getCell(x, y).isRevealed()) {
+        out[BOUNDARY_PLANE * planeSize + index] = 0;
+    }
+}
+
+inline void ObservationPlanes::markBoundaryAround(const Board& board, int x, int y, std::span<uint8_t> out) {
+    // (x, y) is revealed: every unrevealed neighbour is on the frontier
+    const int width = board.getWidth();
+    const size_t planeSize = static_cast<size_t>(width) * board.getHeight();
+    uint8_t* boundary = out.data() + BOUNDARY_PLANE * planeSize;
+    for (int i = std::max(0, x - 1); i <= std::min(board.getHeight() - 1, x + 1); ++i) {
+        for (int j = std::max(0, y - 1); j <= std::min(width - 1, y + 1); ++j) {
+            if (!board.getCell(i, j).isRevealed()) {
+                boundary[static_cast<size_t>(i) * width + j] = 1;
+            }
+        }
+    }
+}
+
+inline bool ObservationPlanes::write(const Board& board, std::span<uint8_t> out) {
+    if (out.size() < size(board.getWidth(), board.getHeight())) {
+        return false;
+    }
+    const size_t planeSize = static_cast<size_t>(board.getWidth()) * board.getHeight();
+    if (const RevealIndex* index = board.getRevealIndex()) {
+        // Every cell starts hidden; only the revealed runs, and rows holding
+        // flags, are written cell by cell
+        std::fill_n(out.data() + HIDDEN_PLANE * planeSize, planeSize, uint8_t{1});
+        std::fill_n(out.data() + FLAG_PLANE * planeSize, (PLANE_COUNT - FLAG_PLANE) * planeSize, uint8_t{0});
+        for (int i = 0; i < board.getHeight(); ++i) {
+            if (index->getFlagCount(i) > 0) {
+                for (int j = 0; j < board.getWidth(); ++j) {
+                    writeCell(board, i, j, out);
+                }
+                continue;
+            }
+            for (const RevealIndex::Run& run : index->getRuns(i)) {
+                for (int j = run.begin; j < run.end; ++j) {
+                    writeCell(board, i, j, out);
+                }
+            }
+        }
+        for (int i = 0; i < board.getHeight(); ++i) {
+            for (const RevealIndex::Run& run : index->getRuns(i)) {
+                for (int j = run.begin; j < run.end; ++j) {
+                    markBoundaryAround(board, i, j, out);
+                }
+            }
+        }
+        return true;
+    }
+    std::fill_n(out.data() + BOUNDARY_PLANE * planeSize, planeSize, uint8_t{0});
+    for (int i = 0; i < board.getHeight(); ++i) {
+        for (int j = 0; j < board.getWidth(); ++j) {
+            writeCell(board, i, j, out);
+        }
+    }
+    for (int i = 0; i < board.getHeight(); ++i) {
+        for (int j = 0; j < board.getWidth(); ++j) {
+            if (board.getCell(i, j).isRevealed()) {
+                markBoundaryAround(board, i, j, out);
+            }
+        }
+    }
+    return true;
+}
+
+inline bool ObservationPlanes::update(const Board& board, const BoardDelta& delta, std::span<uint8_t> out) {
+    // Flags only change their own cell; a reveal also pulls its unrevealed
+    // neighbours onto the frontier. Nothing else can change between moves.
+    if (out.size() < size(board.getWidth(), board.getHeight())) {
+        return false;
+    }
+    for (const BoardDelta::CellChange& change : delta) {
+        writeCell(board, change.x, change.y, out);
+    }
+    for (const BoardDelta::CellChange& change : delta) {
+        if (board.getCell(change.x, change.y).isRevealed()) {
+            markBoundaryAround(board, change.x, change.y, out);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// splitmix64: the small seeded generator behind the engines that keep their own
+// streams (one per game in GameBatch, one per worker in BoardGenerator, one per
+// BitBoard8). A stream is a single uint64_t of state.
+struct SplitMix64 {
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+    static uint64_t next(uint64_t& state);
+    // Uniform in [0, bound) by multiply-shift, bound > 0
+    static uint64_t below(uint64_t& state, uint64_t bound);
+    // Starting state of stream index of a seed; distinct indices give independent streams
+    static uint64_t stream(uint64_t seed, int index);
+};
+
+inline uint64_t SplitMix64::next(uint64_t& state) {
+    uint64_t z = (state += GOLDEN_GAMMA);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+inline uint64_t SplitMix64::below(uint64_t& state, uint64_t bound) {
+    return static_cast<uint64_t>((static_cast<unsigned __int128>(next(state)) * bound) >> 64);
+}
+
+inline uint64_t SplitMix64::stream(uint64_t seed, int index) {
+    uint64_t state = seed + GOLDEN_GAMMA * static_cast<uint64_t>(index + 1);
+    return next(state);
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <bits/stdc++.h>
+#include "Board.h"
+using namespace std;
+
+// Incremental ANSI renderer for the console.
+// Draws a window (viewport) of the board and keeps the glyphs of the last frame;
+// after the first full draw only cells whose glyph changed are re-emitted with
+// cursor-positioning sequences. The window keeps the layout of
+// Board::formatRegion() and sits at the top of the screen; everything below it is
+// cleared each frame so status text can be printed there.
+// Every frame costs O(window), independent of the board size, or O(changed cells)
+// when the caller passes the BoardDelta of the moves since the previous frame.
+class TerminalRenderer {
+public:
+    TerminalRenderer();
+
+    // Force a full redraw on the next frame (screen was cleared or scrolled)
+    void invalidate();
+
+    // Append the escape sequences for the next frame of the rows x cols window
+    // at (x0, y0) to out and leave the cursor on the first line below the board.
+    // With a delta only the listed cells are compared against the last frame.
+    void render(const Board& board, int x0, int y0, int rows, int cols, std::string& out,
+                const BoardDelta* delta = nullptr);
+
+    // Render the next frame and hand it to the stream in a single write
+    void present(const Board& board, int x0, int y0, int rows, int cols, std::ostream& stream,
+                 const BoardDelta* delta = nullptr);
+
+private:
+    void renderFull(const Board& board, std::string& out);
+    void moveCursor(int row, int column, std::string& out) const;
+    int screenRow(int x) const;
+    int screenColumn(int y) const;
+
+    const Board* m_board;
+    int m_boardWidth;
+    int m_boardHeight;
+    int m_x0;
+    int m_y0;
+    int m_rows;
+    int m_cols;
+    int m_labelWidth;
+    int m_headerRows;
+    bool m_valid;
+    std::vector<char> m_frame;
+    std::string m_buffer;
+};
+
+inline TerminalRenderer::TerminalRenderer()
+    : m_board(nullptr)
+    , m_boardWidth(0)
+    , m_boardHeight(0)
+    , m_x0(0)
+    , m_y0(0)
+    , m_rows(0)
+    , m_cols(0)
+    , m_labelWidth(0)
+    , m_headerRows(0)
+    , m_valid(false)
+{
+}
+
+inline void TerminalRenderer::invalidate() {
+    m_valid = false;
+}
+
+inline int TerminalRenderer::screenRow(int x) const {
+    // Rows and columns are 1-based in ANSI cursor positioning
+    return m_headerRows + 1 + (x - m_x0);
+}
+
+inline int TerminalRenderer::screenColumn(int y) const {
+    return m_labelWidth + 2 * (y - m_y0) + 1;
+}
+
+inline void TerminalRenderer::moveCursor(int row, int column, std::string& out) const {
+    char sequence[32];
+    const int length = std::snprintf(sequence, sizeof(sequence), "\x1b[%d;%dH", row, column);
+    out.append(sequence, length);
+}
+
+inline void TerminalRenderer::renderFull(const Board& board, std::string& out) {
+    // Clear the screen and draw the whole window, remembering every glyph
+    m_labelWidth = static_cast<int>(std::to_string(std::max(m_boardHeight - 1, 0)).size()) + 1;
+    m_headerRows = (m_boardWidth > 10 ? 2 : 1) + 1;
+    m_frame.resize(static_cast<size_t>(m_rows) * m_cols);
+
+    out += "\x1b[H\x1b[2J";
+    out += board.formatRegion(m_x0, m_y0, m_rows, m_cols, false);
+    for (int i = 0; i < m_rows; ++i) {
+        for (int j = 0; j < m_cols; ++j) {
+            m_frame[static_cast<size_t>(i) * m_cols + j] = board.getCell(m_x0 + i, m_y0 + j).getDisplayChar();
+        }
+    }
+    m_valid = true;
+}
+
+inline void TerminalRenderer::render(const Board& board, int x0, int y0, int rows, int cols, std::string& out,
+                                     const BoardDelta* delta) {
+    // Clip the window to the board
+    x0 = std::clamp(x0, 0, std::max(0, board.getHeight() - 1));
+    y0 = std::clamp(y0, 0, std::max(0, board.getWidth() - 1));
+    rows = std::max(0, std::min(rows, board.getHeight() - x0));
+    cols = std::max(0, std::min(cols, board.getWidth() - y0));
+
+    // A different board or window invalidates the headers and labels on screen
+    if (&board != m_board || board.getWidth() != m_boardWidth || board.getHeight() != m_boardHeight ||
+        x0 != m_x0 || y0 != m_y0 || rows != m_rows || cols != m_cols) {
+        m_board = &board;
+        m_boardWidth = board.getWidth();
+        m_boardHeight = board.getHeight();
+        m_x0 = x0;
+        m_y0 = y0;
+        m_rows = rows;
+        m_cols = cols;
+        m_valid = false;
+    }
+
+    if (!m_valid) {
+        renderFull(board, out);
+    } else if (delta != nullptr) {
+        for (const BoardDelta::CellChange& change : *delta) {
+            const int i = change.x - m_x0;
+            const int j = change.y - m_y0;
+            if (i < 0 || i >= m_rows || j < 0 || j >= m_cols) {
+                continue;
+            }
+            const char glyph = board.getCell(change.x, change.y).getDisplayChar();
+            char& previous = m_frame[static_cast<size_t>(i) * m_cols + j];
+            if (glyph != previous) {
+                previous = glyph;
+                moveCursor(screenRow(change.x), screenColumn(change.y), out);
+                out += glyph;
+            }
+        }
+    } else {
+        for (int i = 0; i < m_rows; ++i) {
+            char* row = &m_frame[static_cast<size_t>(i) * m_cols];
+            // Window column just after the last glyph written on this row, -1 if the cursor is elsewhere
+            int cursorAfter = -1;
+            for (int j = 0; j < m_cols; ++j) {
+                const char glyph = board.getCell(m_x0 + i, m_y0 + j).getDisplayChar();
+                if (glyph == row[j]) {
+                    continue;
+                }
+                row[j] = glyph;
+                if (cursorAfter == j - 1 && j > 0) {
+                    // Adjacent change: step over the separator instead of repositioning
+                    out += ' ';
+                } else {
+                    moveCursor(screenRow(m_x0 + i), screenColumn(m_y0 + j), out);
+                }
+                out += glyph;
+                cursorAfter = j;
+            }
+        }
+    }
+    // Park the cursor under the board and clear the old status area
+    moveCursor(screenRow(m_x0 + m_rows), 1, out);
+    out += "\x1b[J";
+}
+
+inline void TerminalRenderer::present(const Board& board, int x0, int y0, int rows, int cols, std::ostream& stream,
+                                      const BoardDelta* delta) {
+    m_buffer.clear();
+    render(board, x0, y0, rows, cols, m_buffer, delta);
+    stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <bits/stdc++.h>
+using namespace std;
+
+// Fixed set of worker threads for data-parallel loops.
+// parallelFor() hands out the indices [0, count) to the workers and to the
+// calling thread and returns once all of them ran; the first exception thrown
+// by a task is rethrown to the caller. A task that calls parallelFor() on the
+// same pool runs the inner loop inline on its own thread, since every thread of
+// the pool is already busy with the outer one. Calls from different threads are
+// serialized.
+class ThreadPool {
+public:
+    // workers extra threads; the caller of parallelFor() takes part as well
+    explicit ThreadPool(int workers);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Threads that run tasks during parallelFor(), the caller included
+    int size() const;
+
+    void parallelFor(int count, const std::function<void(int index)>& task);
+
+    // Process-wide pool with one thread per hardware thread
+    static ThreadPool& shared();
+
+private:
+    void workerLoop();
+    void runTasks();
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_submitMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    const std::function<void(int)>* m_task;
+    int m_count;
+    std::atomic<int> m_next;
+    int m_active;
+    uint64_t m_generation;
+    bool m_stop;
+    std::exception_ptr m_error;
+
+    // Pool whose tasks the current thread is running, if any
+    static thread_local const ThreadPool* s_running;
+};
+
+inline thread_local const ThreadPool* ThreadPool::s_running = nullptr;
+
+inline ThreadPool::ThreadPool(int workers)
+    : m_task(nullptr)
+    , m_count(0)
+    , m_next(0)
+    , m_active(0)
+    , m_generation(0)
+    , m_stop(false)
+{
+    for (int i = 0; i < workers; ++i) {
+        m_threads.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+inline int ThreadPool::size() const {
+    return static_cast<int>(m_threads.size()) + 1;
+}
+
+inline ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool(std::max(1, static_cast<int>(std::thread::hardware_concurrency())) - 1);
+    return pool;
+}
+
+inline void ThreadPool::runTasks() {
+    // Indices are claimed one at a time, so uneven tasks balance themselves
+    const ThreadPool* outer = std::exchange(s_running, this);
+    for (int index = m_next.fetch_add(1); index < m_count; index = m_next.fetch_add(1)) {
+        try {
+            (*m_task)(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error) {
+                m_error = std::current_exception();
+            }
+        }
+    }
+    s_running = outer;
+}
+
+inline void ThreadPool::workerLoop() {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+        if (m_stop) {
+            return;
+        }
+        seen = m_generation;
+        lock.unlock();
+        runTasks();
+        lock.lock();
+        if (--m_active == 0) {
+            m_done.notify_one();
+        }
+    }
+}
+
+inline void ThreadPool::parallelFor(int count, const std::function<void(int index)>& task) {
+    if (count <= 0) {
+        return;
+    }
+    if (m_threads.empty() || count == 1 || s_running == this) {
+        for (int index = 0; index < count; ++index) {
+            task(index);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(m_submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_next.store(0);
+        m_active = static_cast<int>(m_threads.size());
+        m_error = nullptr;
+        ++m_generation;
+    }
+    m_wake.notify_all();
+    runTasks();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [&] { return m_active == 0; });
+        m_task = nullptr;
+        error = m_error;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}